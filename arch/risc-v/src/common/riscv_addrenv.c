@@ -38,6 +38,8 @@
  *   up_addrenv_select   - Instantiate an address environment
  *   up_addrenv_clone    - Copy an address environment from one location to
  *                        another.
+ *   up_addrenv_fork     - Create a copy-on-write duplicate of an address
+ *                         environment for a fork()'ed child.
  *
  * Higher-level interfaces used by the tasking logic.  These interfaces are
  * used by the functions in sched/ and all operate on the thread which whose
@@ -558,7 +560,15 @@ int up_addrenv_destroy(arch_addrenv_t *addrenv)
                       paddr = mmu_pte_to_paddr(ptlast[j]);
                       if (paddr)
                         {
+#ifdef CONFIG_ARCH_ADDRENV_COW
+                          /* The page may still be shared with a fork()'ed
+                           * parent or child.
+                           */
+
+                          mm_pgunref(paddr);
+#else
                           mm_pgfree(paddr, 1);
+#endif
                         }
                     }
                 }
@@ -773,6 +783,142 @@ int up_addrenv_clone(const arch_addrenv_t *src,
   return OK;
 }
 
+/****************************************************************************
+ * Name: up_addrenv_fork
+ *
+ * Description:
+ *   Create a copy-on-write duplicate of an address environment for a
+ *   fork()'ed child.  The new address environment maps the same physical
+ *   pages as the source.  Writable pages are made read-only in both and
+ *   are copied by the page fault handler on the first write.  The source
+ *   must be the address environment that is currently selected.
+ *
+ * Input Parameters:
+ *   src - The address environment of the parent.
+ *   dest - The location to receive the new address environment.
+ *
+ * Returned Value:
+ *   Zero (OK) on success; a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_ARCH_ADDRENV_COW
+int up_addrenv_fork(arch_addrenv_t *src, arch_addrenv_t *dest)
+{
+  uintptr_t *srcprev;
+  uintptr_t *srclast;
+  uintptr_t *destlast;
+  uintptr_t  destprev;
+  uintptr_t  paddr;
+  uintptr_t  vaddr;
+  uintptr_t  entry;
+  irqstate_t flags;
+  size_t     pgsize;
+  int        ret;
+  int        i;
+  int        j;
+
+  DEBUGASSERT(src && dest);
+
+  memset(dest, 0, sizeof(arch_addrenv_t));
+
+  /* Create the static page tables and map the kernel memory */
+
+  ret = create_spgtables(dest);
+  if (ret < 0)
+    {
+      goto errout;
+    }
+
+  ret = copy_kernel_mappings(dest);
+  if (ret < 0)
+    {
+      goto errout;
+    }
+
+  /* Walk the user space of the source, the same way as
+   * up_addrenv_destroy() does.
+   */
+
+  vaddr    = ARCH_ADDRENV_VBASE;
+  pgsize   = mmu_get_region_size(ARCH_SPGTS);
+  srcprev  = (uintptr_t *)riscv_pgvaddr(src->spgtables[ARCH_SPGTS - 1]);
+  destprev = riscv_pgvaddr(dest->spgtables[ARCH_SPGTS - 1]);
+
+  i = (ARCH_SPGTS < 2) ? vaddr / pgsize : 0;
+  for (; i < ENTRIES_PER_PGT; i++, vaddr += pgsize)
+    {
+      srclast = (uintptr_t *)riscv_pgvaddr(mmu_pte_to_paddr(srcprev[i]));
+      if (!srclast || vaddr_is_shm(vaddr))
+        {
+          /* Shared memory attachments are not inherited */
+
+          continue;
+        }
+
+      /* Allocate the final level page table of the child */
+
+      paddr = mm_pgalloc(1);
+      if (!paddr)
+        {
+          ret = -ENOMEM;
+          goto errout;
+        }
+
+      riscv_pgwipe(paddr);
+      map_spgtables(dest, vaddr);
+      mmu_ln_setentry(ARCH_SPGTS, destprev, paddr, vaddr, MMU_UPGT_FLAGS);
+      destlast = (uintptr_t *)riscv_pgvaddr(paddr);
+
+      /* Share every mapped page, write protecting the writable ones.  A
+       * write fault must not observe a page that is marked but not yet
+       * referenced.
+       */
+
+      flags = up_irq_save();
+
+      for (j = 0; j < ENTRIES_PER_PGT; j++)
+        {
+          entry = srclast[j];
+          if ((entry & PTE_VALID) == 0)
+            {
+              continue;
+            }
+
+          if ((entry & PTE_W) != 0)
+            {
+              entry      = (entry & ~PTE_W) | PTE_COW;
+              srclast[j] = entry;
+            }
+
+          mm_pgref(mmu_pte_to_paddr(entry));
+          destlast[j] = entry;
+        }
+
+      up_irq_restore(flags);
+    }
+
+  dest->textvbase = src->textvbase;
+  dest->datavbase = src->datavbase;
+  dest->heapvbase = src->heapvbase;
+  dest->heapsize  = src->heapsize;
+  dest->satp      = mmu_satp_reg(dest->spgtables[0], 0);
+
+  /* The source is the active address environment, drop the stale
+   * writable translations.
+   */
+
+  UP_DMB();
+  mmu_invalidate_tlbs();
+
+  return OK;
+
+errout:
+  up_addrenv_destroy(dest);
+  return ret;
+}
+#endif
+
 /****************************************************************************
  * Name: up_addrenv_attach
  *
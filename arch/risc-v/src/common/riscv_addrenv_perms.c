@@ -90,6 +90,21 @@ static int modify_region(uintptr_t vstart, uintptr_t vend, uintptr_t setmask)
       entry &= ~CLR_MASK;
       entry |= setmask;
 
+#ifdef CONFIG_ARCH_ADDRENV_COW
+      /* A page still shared with another address environment becomes
+       * writable only on its first write fault.  A read-only page is not
+       * copy-on-write, so that a write to it still faults; it becomes
+       * copy-on-write again when it is made writable while still shared.
+       */
+
+      entry &= ~PTE_COW;
+      if ((setmask & PTE_W) != 0 && (entry & PTE_VALID) != 0 &&
+          mm_pgrefs(mmu_pte_to_paddr(entry)) > 1)
+        {
+          entry = (entry & ~PTE_W) | PTE_COW;
+        }
+#endif
+
       /* Restore the entry */
 
       mmu_ln_restore(ptlevel, lnvaddr, vaddr, entry);
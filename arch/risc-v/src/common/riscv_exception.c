@@ -32,11 +32,12 @@
 
 #include <nuttx/irq.h>
 #include <nuttx/arch.h>
-#ifdef CONFIG_PAGING
+#if defined(CONFIG_PAGING) || defined(CONFIG_ARCH_ADDRENV_COW)
+#  include <string.h>
 #  include <nuttx/pgalloc.h>
 #endif
 
-#ifdef CONFIG_PAGING
+#if defined(CONFIG_PAGING) || defined(CONFIG_ARCH_ADDRENV_COW)
 #  include "pgalloc.h"
 #  include "riscv_mmu.h"
 #endif
@@ -248,6 +249,99 @@ int riscv_fillpage(int mcause, void *regs, void *args)
 }
 #endif /* CONFIG_PAGING */
 
+/****************************************************************************
+ * Name: riscv_cowfault
+ *
+ * Description:
+ *   Store page fault handler for address environments shared by fork().
+ *   If the faulting page is marked copy-on-write, it is either copied to a
+ *   private page or, if nobody else maps it anymore, simply made writable
+ *   again.  Any other fault is handed to the regular handler.
+ *
+ * Input Parameters:
+ *   mcause - The machine cause of the exception.
+ *   regs   - A pointer to the register state at the time of the exception.
+ *   args   - A pointer to any additional arguments.
+ *
+ * Returned Value:
+ *   Zero (OK) on success; a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_ARCH_ADDRENV_COW
+int riscv_cowfault(int mcause, void *regs, void *args)
+{
+  uintptr_t lnvaddr;
+  uintptr_t entry;
+  uintptr_t paddr;
+  uintptr_t vaddr;
+  uintptr_t page;
+  uint32_t  ptlevel;
+  uint64_t  mmuflags;
+
+  vaddr   = MM_PGALIGNDOWN(READ_CSR(CSR_TVAL));
+  lnvaddr = riscv_pgvaddr(mmu_satp_to_paddr(READ_CSR(CSR_SATP)));
+
+  /* Walk down to the final level page table */
+
+  for (ptlevel = 1; ptlevel < RV_MMU_PT_LEVELS; ptlevel++)
+    {
+      entry = mmu_ln_getentry(ptlevel, lnvaddr, vaddr);
+      if ((entry & PTE_VALID) == 0 || (entry & PTE_LEAF_MASK) != 0)
+        {
+          goto notcow;
+        }
+
+      lnvaddr = riscv_pgvaddr(mmu_pte_to_paddr(entry));
+    }
+
+  entry = mmu_ln_getentry(ptlevel, lnvaddr, vaddr);
+  if ((entry & PTE_VALID) == 0 || (entry & PTE_COW) == 0)
+    {
+      goto notcow;
+    }
+
+  /* Keep the flags of the mapping, i.e. everything but the PPN, and make
+   * it writable again.
+   */
+
+  paddr    = mmu_pte_to_paddr(entry);
+  mmuflags = (entry ^ (paddr >> RV_MMU_PTE_PPN_SHIFT)) & ~PTE_COW;
+  mmuflags = (mmuflags & ~PTE_VALID) | PTE_W;
+
+  if (mm_pgrefs(paddr) > 1)
+    {
+      /* Still shared, give this address environment its own copy */
+
+      page = mm_pgalloc(1);
+      if (!page)
+        {
+          _alert("PANIC!!! Out of pages for copy-on-write: %" PRIxPTR "\n",
+                 vaddr);
+          up_irq_save();
+          up_set_interrupt_context(true);
+          PANIC_WITH_REGS("panic", regs);
+        }
+
+      memcpy((void *)riscv_pgvaddr(page), (void *)riscv_pgvaddr(paddr),
+             MM_PGSIZE);
+      mm_pgunref(paddr);
+      paddr = page;
+    }
+
+  mmu_ln_setentry(ptlevel, lnvaddr, paddr, vaddr, mmuflags);
+  mmu_invalidate_tlb_by_vaddr(vaddr);
+  return 0;
+
+notcow:
+#ifdef CONFIG_PAGING
+  return riscv_fillpage(mcause, regs, args);
+#else
+  return riscv_exception(mcause, regs, args);
+#endif
+}
+#endif /* CONFIG_ARCH_ADDRENV_COW */
+
 /****************************************************************************
  * Name: riscv_exception_attach
  *
@@ -292,7 +386,13 @@ void riscv_exception_attach(void)
 
   irq_attach(RISCV_IRQ_INSTRUCTIONPF, riscv_exception, NULL);
 
-#ifdef CONFIG_PAGING
+#if defined(CONFIG_ARCH_ADDRENV_COW) && defined(CONFIG_PAGING)
+  irq_attach(RISCV_IRQ_LOADPF, riscv_fillpage, NULL);
+  irq_attach(RISCV_IRQ_STOREPF, riscv_cowfault, NULL);
+#elif defined(CONFIG_ARCH_ADDRENV_COW)
+  irq_attach(RISCV_IRQ_LOADPF, riscv_exception, NULL);
+  irq_attach(RISCV_IRQ_STOREPF, riscv_cowfault, NULL);
+#elif defined(CONFIG_PAGING)
   irq_attach(RISCV_IRQ_LOADPF, riscv_fillpage, NULL);
   irq_attach(RISCV_IRQ_STOREPF, riscv_fillpage, NULL);
 #else
@@ -47,6 +47,7 @@
 #define PTE_G                   (1 << 5) /* Page is a global mapping */
 #define PTE_A                   (1 << 6) /* Page has been accessed */
 #define PTE_D                   (1 << 7) /* Page is dirty */
+#define PTE_COW                 (1 << 8) /* RSW: Page is copy-on-write */
 
 /* T-Head MMU needs Text and Data to be Shareable, Bufferable, Cacheable */
 
@@ -36,9 +36,11 @@
 #include <nuttx/kthread.h>
 #include <nuttx/mm/iob.h>
 #include <nuttx/net/can.h>
+#include <nuttx/net/ip.h>
 #include <nuttx/net/net.h>
 #include <nuttx/net/netdev_lowerhalf.h>
 #include <nuttx/net/pkt.h>
+#include <nuttx/net/tcp.h>
 #include <nuttx/semaphore.h>
 #include <nuttx/spinlock.h>
 
@@ -210,7 +212,7 @@ netdev_upper_alloc(FAR struct netdev_lowerhalf_s *dev)
 
   DEBUGASSERT(dev != NULL && dev->netdev.d_private == NULL);
 
-  upper = kmm_zalloc(sizeof(struct netdev_upperhalf_s));
+  upper = kmm_zalloc_longlived(sizeof(struct netdev_upperhalf_s));
   if (upper == NULL)
     {
       nerr("ERROR: Allocation failed\n");
@@ -248,6 +250,254 @@ static inline bool netdev_upper_can_tx(FAR struct netdev_upperhalf_s *upper)
   return quota > 0;
 }
 
+/****************************************************************************
+ * Name: netdev_upper_gso_fixup
+ *
+ * Description:
+ *   Update the IP and TCP headers of one segment of a super-segment, which
+ *   is in d_iob.
+ *
+ * Assumptions:
+ *   Called with the network locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_GSO
+static void netdev_upper_gso_fixup(FAR struct net_driver_s *dev,
+                                   unsigned int iphdrlen, uint32_t seqno,
+                                   uint16_t ipid, uint8_t flags)
+{
+  FAR struct tcp_hdr_s *tcp = IPBUF(iphdrlen);
+  uint16_t len = dev->d_iob->io_pktlen;
+
+  tcp->seqno[0]  = seqno >> 24;
+  tcp->seqno[1]  = seqno >> 16;
+  tcp->seqno[2]  = seqno >> 8;
+  tcp->seqno[3]  = seqno;
+  tcp->flags     = flags;
+  tcp->tcpchksum = 0;
+
+#ifdef CONFIG_NET_IPv4
+  if ((IPv4BUF->vhl & IP_VERSION_MASK) == IPv4_VERSION)
+    {
+      FAR struct ipv4_hdr_s *ipv4 = IPv4BUF;
+
+      ipv4->len[0]   = len >> 8;
+      ipv4->len[1]   = len & 0xff;
+      ipv4->ipid[0]  = ipid >> 8;
+      ipv4->ipid[1]  = ipid & 0xff;
+      ipv4->ipchksum = 0;
+#ifdef CONFIG_NET_IPV4_CHECKSUMS
+      ipv4->ipchksum = ~ipv4_chksum(ipv4);
+#endif
+#ifdef CONFIG_NET_TCP_CHECKSUMS
+      tcp->tcpchksum = ~ipv4_upperlayer_chksum(dev, IP_PROTO_TCP);
+#endif
+    }
+#endif
+
+#ifdef CONFIG_NET_IPv6
+  if ((IPv6BUF->vtc & IP_VERSION_MASK) == IPv6_VERSION)
+    {
+      FAR struct ipv6_hdr_s *ipv6 = IPv6BUF;
+
+      len           -= iphdrlen;
+      ipv6->len[0]   = len >> 8;
+      ipv6->len[1]   = len & 0xff;
+#ifdef CONFIG_NET_TCP_CHECKSUMS
+      tcp->tcpchksum = ~ipv6_upperlayer_chksum(dev, IP_PROTO_TCP,
+                                               iphdrlen);
+#endif
+    }
+#endif
+}
+
+/****************************************************************************
+ * Name: netdev_upper_gso_segment
+ *
+ * Description:
+ *   Split the TCP super-segment in d_iob into segments of d_gso_size bytes
+ *   of data, and queue them to txq.  The segments which cannot be
+ *   allocated are dropped, TCP retransmits them.  The IPv4 segments take
+ *   the consecutive IP IDs the stack reserved for the super-segment.
+ *
+ * Assumptions:
+ *   Called with the network locked.
+ *
+ ****************************************************************************/
+
+static void netdev_upper_gso_segment(FAR struct net_driver_s *dev,
+                                     unsigned int iphdrlen,
+                                     unsigned int hdrlen)
+{
+  FAR struct netdev_upperhalf_s *upper = dev->d_private;
+  FAR struct iob_s *super = dev->d_iob;
+  FAR struct tcp_hdr_s *tcp = IPBUF(iphdrlen);
+  unsigned int llhdrlen = NET_LL_HDRLEN(dev);
+  unsigned int total = super->io_pktlen - hdrlen;
+  unsigned int offset;
+  unsigned int len;
+  FAR struct iob_s *seg;
+  uint32_t seqno;
+  uint16_t ipid = 0;
+  uint8_t flags;
+
+  seqno = ((uint32_t)tcp->seqno[0] << 24) | ((uint32_t)tcp->seqno[1] << 16) |
+          ((uint32_t)tcp->seqno[2] << 8) | tcp->seqno[3];
+
+#ifdef CONFIG_NET_IPv4
+  if ((IPv4BUF->vhl & IP_VERSION_MASK) == IPv4_VERSION)
+    {
+      ipid = ((uint16_t)IPv4BUF->ipid[0] << 8) | IPv4BUF->ipid[1];
+    }
+#endif
+
+  for (offset = 0; offset < total; offset += len)
+    {
+      len = MIN(dev->d_gso_size, total - offset);
+
+      /* Only the first segment keeps CWR, only the last FIN and PSH */
+
+      flags = tcp->flags;
+      if (offset > 0)
+        {
+          flags &= ~TCP_CWR;
+        }
+
+      if (offset + len < total)
+        {
+          flags &= ~(TCP_FIN | TCP_PSH);
+        }
+
+      seg = iob_tryalloc(false);
+      if (seg == NULL)
+        {
+          break;
+        }
+
+      iob_reserve(seg, CONFIG_NET_LL_GUARDSIZE);
+      memcpy(IOB_DATA(seg) - llhdrlen, IOB_DATA(super) - llhdrlen,
+             llhdrlen + hdrlen);
+
+      if (iob_clone_partial(super, len, hdrlen + offset, seg, hdrlen,
+                            false, false) < 0)
+        {
+          iob_free_chain(seg);
+          break;
+        }
+
+      dev->d_iob = seg;
+      netdev_upper_gso_fixup(dev, iphdrlen, seqno + offset, ipid++, flags);
+      dev->d_iob = super;
+
+      if (iob_tryadd_queue(seg, &upper->txq) < 0)
+        {
+          iob_free_chain(seg);
+          break;
+        }
+    }
+
+  if (offset < total)
+    {
+      nwarn("WARNING: Dropping TCP segments of %s\n", dev->d_ifname);
+      NETDEV_TXERRORS(dev);
+    }
+
+  netdev_iob_release(dev);
+}
+
+/****************************************************************************
+ * Name: netdev_upper_gso
+ *
+ * Description:
+ *   Prepare a TCP super-segment in d_iob for transmission.  It is left for
+ *   the lower half if tso is true and the lower half supports TSO for it,
+ *   otherwise it is split into txq and released.
+ *
+ * Returned Value:
+ *   true if d_iob has been split, false if it is left for the lower half.
+ *
+ * Assumptions:
+ *   Called with the network locked.
+ *
+ ****************************************************************************/
+
+static bool netdev_upper_gso(FAR struct net_driver_s *dev, bool tso)
+{
+  FAR struct netdev_upperhalf_s *upper = dev->d_private;
+  FAR struct tcp_hdr_s *tcp;
+  unsigned int iphdrlen;
+  unsigned int hdrlen;
+  uint32_t feature;
+
+  if (dev->d_gso_size == 0)
+    {
+      return false;
+    }
+
+  /* Make sure that the stack did not replace the packet meanwhile */
+
+#ifdef CONFIG_NET_IPv4
+  if ((IPv4BUF->vhl & IP_VERSION_MASK) == IPv4_VERSION &&
+      IPv4BUF->proto == IP_PROTO_TCP)
+    {
+      iphdrlen = (IPv4BUF->vhl & IPv4_HLMASK) << 2;
+      feature  = NETDEV_F_TSO4;
+    }
+  else
+#endif
+#ifdef CONFIG_NET_IPv6
+  if ((IPv6BUF->vtc & IP_VERSION_MASK) == IPv6_VERSION &&
+      IPv6BUF->proto == IP_PROTO_TCP)
+    {
+      iphdrlen = IPv6_HDRLEN;
+      feature  = NETDEV_F_TSO6;
+    }
+  else
+#endif
+    {
+      dev->d_gso_size = 0;
+      return false;
+    }
+
+  tcp    = IPBUF(iphdrlen);
+  hdrlen = iphdrlen + ((tcp->tcpoffset >> 4) << 2);
+  if (hdrlen > dev->d_iob->io_len ||
+      dev->d_iob->io_pktlen <= hdrlen + dev->d_gso_size)
+    {
+      dev->d_gso_size = 0;
+      return false;
+    }
+
+  if (tso && (upper->lower->features & feature) != 0)
+    {
+      /* The hardware completes the checksum of each segment */
+
+#ifdef CONFIG_NET_IPv4
+      if (feature == NETDEV_F_TSO4)
+        {
+          tcp->tcpchksum =
+            HTONS(ipv4_upperlayer_header_chksum(dev, IP_PROTO_TCP));
+        }
+#endif
+#ifdef CONFIG_NET_IPv6
+      if (feature == NETDEV_F_TSO6)
+        {
+          tcp->tcpchksum =
+            HTONS(ipv6_upperlayer_header_chksum(dev, IP_PROTO_TCP,
+                                                iphdrlen));
+        }
+#endif
+
+      return false;
+    }
+
+  netdev_upper_gso_segment(dev, iphdrlen, hdrlen);
+  dev->d_gso_size = 0;
+  return true;
+}
+#endif /* CONFIG_NET_TCP_GSO */
+
 /****************************************************************************
  * Name: netdev_upper_txpoll
  *
@@ -278,10 +528,24 @@ static int netdev_upper_txpoll(FAR struct net_driver_s *dev)
   FAR struct netdev_upperhalf_s *upper = dev->d_private;
   FAR struct netdev_lowerhalf_s *lower = upper->lower;
   FAR netpkt_t                  *pkt;
+  unsigned int                   maxlen = NETDEV_PKTSIZE(dev);
   int                            ret;
 
   DEBUGASSERT(dev->d_len > 0);
 
+#ifdef CONFIG_NET_TCP_GSO
+  if (netdev_upper_gso(dev, true))
+    {
+      /* The segments are sent from txq by the next rounds */
+
+      return NETDEV_TX_CONTINUE;
+    }
+  else if (dev->d_gso_size > 0)
+    {
+      maxlen = NET_LL_HDRLEN(dev) + dev->d_gso_max;
+    }
+#endif
+
   NETDEV_TXPACKETS(dev);
 
 #ifdef CONFIG_NET_PKT
@@ -292,7 +556,7 @@ static int netdev_upper_txpoll(FAR struct net_driver_s *dev)
 
   pkt = netpkt_get(dev, NETPKT_TX);
 
-  if (netpkt_getdatalen(lower, pkt) > NETDEV_PKTSIZE(dev))
+  if (netpkt_getdatalen(lower, pkt) > maxlen)
     {
       nerr("ERROR: Packet too long to send!\n");
       ret = -EMSGSIZE;
@@ -302,6 +566,10 @@ static int netdev_upper_txpoll(FAR struct net_driver_s *dev)
       ret = lower->ops->transmit(lower, pkt);
     }
 
+#ifdef CONFIG_NET_TCP_GSO
+  dev->d_gso_size = 0;
+#endif
+
   if (ret != OK)
     {
       /* Stop polling on any error
@@ -404,6 +672,15 @@ static void netdev_upper_queue_tx(FAR struct net_driver_s *dev)
   FAR struct netdev_upperhalf_s *upper = dev->d_private;
   int ret;
 
+#ifdef CONFIG_NET_TCP_GSO
+  /* The TSO size is lost in txq, so split super-segments right away */
+
+  if (netdev_upper_gso(dev, false))
+    {
+      return;
+    }
+#endif
+
   if ((ret = iob_tryadd_queue(dev->d_iob, &upper->txq)) >= 0)
     {
       netdev_iob_clear(dev);
@@ -1218,6 +1495,15 @@ int netdev_lower_register(FAR struct netdev_lowerhalf_s *dev,
 #endif
   dev->netdev.d_private = upper;
 
+#ifdef CONFIG_NET_TCP_GSO
+  /* Super-segments are split in software if the hardware can't */
+
+  if (dev->netdev.d_gso_max == 0)
+    {
+      dev->netdev.d_gso_max = CONFIG_NET_TCP_GSO_MAXSIZE;
+    }
+#endif
+
   ret = netdev_register(&dev->netdev, lltype);
   if (ret < 0)
     {
@@ -1406,6 +1692,68 @@ FAR netpkt_t *netpkt_alloc(FAR struct netdev_lowerhalf_s *dev,
   return pkt;
 }
 
+/****************************************************************************
+ * Name: netpkt_wrap
+ *
+ * Description:
+ *   Wrap a frame that lives in a driver owned buffer as a netpkt without
+ *   copying it.
+ *
+ * Input Parameters:
+ *   dev    - The lower half device driver structure
+ *   ext    - The external buffer, see iob_extbuf_init()
+ *   offset - Offset of the frame (starting with the L2 header) in ext
+ *   len    - Length of the frame, including the L2 header
+ *   size   - Room for the frame from offset on, at least len
+ *   type   - Whether used for TX or RX
+ *
+ * Returned Value:
+ *   Pointer to the packet, NULL on failure
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_IOB_ALLOC
+FAR netpkt_t *netpkt_wrap(FAR struct netdev_lowerhalf_s *dev,
+                          FAR struct iob_extbuf_s *ext,
+                          unsigned int offset, unsigned int len,
+                          unsigned int size, enum netpkt_type_e type)
+{
+  uint8_t llhdrlen = NET_LL_HDRLEN(&dev->netdev);
+  unsigned int headroom = CONFIG_NET_LL_GUARDSIZE - llhdrlen;
+  FAR netpkt_t *pkt;
+
+  /* The stack reuses RX packets for replies in place, and drivers put
+   * their own header in front of the L2 header, so the packet needs the
+   * guard area and the tailroom of a netpkt from netpkt_alloc().
+   */
+
+  if (len < llhdrlen || len > size || offset < headroom ||
+      headroom + size < CONFIG_IOB_BUFSIZE ||
+      offset + size > UINT16_MAX)
+    {
+      return NULL;
+    }
+
+  if (atomic_fetch_sub(&dev->quota[type], 1) <= 0)
+    {
+      atomic_fetch_add(&dev->quota[type], 1);
+      return NULL;
+    }
+
+  pkt = iob_alloc_extbuf(ext, offset - headroom, headroom + size);
+  if (pkt == NULL)
+    {
+      atomic_fetch_add(&dev->quota[type], 1);
+      return NULL;
+    }
+
+  pkt->io_offset = CONFIG_NET_LL_GUARDSIZE;
+  pkt->io_len    = len - llhdrlen;
+  pkt->io_pktlen = pkt->io_len;
+  return pkt;
+}
+#endif
+
 /****************************************************************************
  * Name: netpkt_free
  *
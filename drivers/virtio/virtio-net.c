@@ -33,6 +33,7 @@
 #include <nuttx/kmalloc.h>
 #include <nuttx/net/ip.h>
 #include <nuttx/net/netdev_lowerhalf.h>
+#include <nuttx/net/tcp.h>
 #include <nuttx/virtio/virtio.h>
 #include <nuttx/net/wifi_sim.h>
 
@@ -44,7 +45,16 @@
 
 /* Virtio net feature bits */
 
-#define VIRTIO_NET_F_MAC      5
+#define VIRTIO_NET_F_CSUM       0
+#define VIRTIO_NET_F_MAC        5
+#define VIRTIO_NET_F_HOST_TSO4  11
+#define VIRTIO_NET_F_HOST_TSO6  12
+
+/* Virtio net header flags and GSO types */
+
+#define VIRTIO_NET_HDR_F_NEEDS_CSUM  1
+#define VIRTIO_NET_HDR_GSO_TCPV4     1
+#define VIRTIO_NET_HDR_GSO_TCPV6     4
 
 /* Virtio net header size and packet buffer size */
 
@@ -63,6 +73,23 @@
 #define VIRTIO_NET_MAX_NIOB \
     ((VIRTIO_NET_MAX_PKT_SIZE + CONFIG_IOB_BUFSIZE - 1) / CONFIG_IOB_BUFSIZE)
 
+/* A TSO super-segment may take more IOBs than a regular packet */
+
+#ifdef CONFIG_DRIVERS_VIRTIO_NET_TSO
+#  define VIRTIO_NET_TSO_NIOB \
+    ((CONFIG_NET_LL_GUARDSIZE + CONFIG_NET_TCP_GSO_MAXSIZE + \
+      CONFIG_IOB_BUFSIZE - 1) / CONFIG_IOB_BUFSIZE)
+#  define VIRTIO_NET_TX_NIOB  MAX(VIRTIO_NET_TSO_NIOB, VIRTIO_NET_MAX_NIOB)
+
+/* The number of TX packets queued with TSO, each of them may take up to
+ * 1/VIRTIO_NET_TSO_TXNUM of the TX virtqueue.
+ */
+
+#  define VIRTIO_NET_TSO_TXNUM 8
+#else
+#  define VIRTIO_NET_TX_NIOB  VIRTIO_NET_MAX_NIOB
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -117,7 +144,8 @@ struct virtio_net_priv_s
   /* Virtio device information */
 
   FAR struct virtio_device *vdev;      /* Virtio device pointer */
-  int                       bufnum;    /* TX and RX Buffer number */
+  int                       rxnum;     /* RX Buffer number */
+  int                       txnum;     /* TX Buffer number */
 };
 
 /* Virtio Link Layer Header, follow shows the iob buffer layout:
@@ -205,24 +233,68 @@ static uint8_t g_netdev_num = 0;
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: virtio_net_tsohdr
+ *
+ * Description:
+ *   Fill the virtio net header of a TCP super-segment, the TCP checksum of
+ *   which only covers the pseudo-header.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_DRIVERS_VIRTIO_NET_TSO
+static void virtio_net_tsohdr(FAR struct netdev_lowerhalf_s *dev,
+                              FAR netpkt_t *pkt,
+                              FAR struct virtio_net_hdr_s *vhdr)
+{
+  FAR uint8_t *ip = IOB_DATA(pkt);
+  FAR struct tcp_hdr_s *tcp;
+  unsigned int iphdrlen;
+
+  if ((ip[0] & IP_VERSION_MASK) == IPv4_VERSION)
+    {
+      iphdrlen       = (ip[0] & IPv4_HLMASK) << 2;
+      vhdr->gso_type = VIRTIO_NET_HDR_GSO_TCPV4;
+    }
+  else
+    {
+      iphdrlen       = IPv6_HDRLEN;
+      vhdr->gso_type = VIRTIO_NET_HDR_GSO_TCPV6;
+    }
+
+  tcp               = (FAR struct tcp_hdr_s *)(ip + iphdrlen);
+  vhdr->flags       = VIRTIO_NET_HDR_F_NEEDS_CSUM;
+  vhdr->csum_start  = NET_LL_HDRLEN(&dev->netdev) + iphdrlen;
+  vhdr->csum_offset = offsetof(struct tcp_hdr_s, tcpchksum);
+  vhdr->hdr_len     = vhdr->csum_start + ((tcp->tcpoffset >> 4) << 2);
+  vhdr->gso_size    = dev->netdev.d_gso_size;
+}
+#endif
+
 /****************************************************************************
  * Name: virtio_net_addbuffer
+ *
+ * Description:
+ *   Add pkt to the virtqueue.  The caller provides the scratch arrays sized
+ *   for the packets of that queue: niob entries for iov and niob + 1 for
+ *   vb.
+ *
  ****************************************************************************/
 
 static int virtio_net_addbuffer(FAR struct netdev_lowerhalf_s *dev,
                                 FAR struct virtqueue *vq, FAR netpkt_t *pkt,
-                                unsigned int vq_id)
+                                unsigned int vq_id,
+                                FAR struct virtqueue_buf *vb,
+                                FAR struct iovec *iov, int niob)
 {
   FAR struct virtio_net_priv_s *priv = (FAR struct virtio_net_priv_s *)dev;
   FAR struct virtio_net_llhdr_s *hdr;
-  struct virtqueue_buf vb[VIRTIO_NET_MAX_NIOB + 1];
-  struct iovec iov[VIRTIO_NET_MAX_NIOB];
   int iov_cnt;
   int i;
 
   /* Convert netpkt to virtqueue_buf */
 
-  iov_cnt = netpkt_to_iov(dev, pkt, iov, VIRTIO_NET_MAX_NIOB);
+  iov_cnt = netpkt_to_iov(dev, pkt, iov, niob);
 
   /* Alloc cookie and net header from transport layer */
 
@@ -232,6 +304,13 @@ static int virtio_net_addbuffer(FAR struct netdev_lowerhalf_s *dev,
   memset(&hdr->vhdr, 0, sizeof(hdr->vhdr));
   hdr->pkt = pkt;
 
+#ifdef CONFIG_DRIVERS_VIRTIO_NET_TSO
+  if (vq_id == VIRTIO_NET_TX && dev->netdev.d_gso_size > 0)
+    {
+      virtio_net_tsohdr(dev, pkt, &hdr->vhdr);
+    }
+#endif
+
   /* Prepare buffers depends on the feature VIRTIO_F_ANY_LAYOUT */
 
   if (virtio_has_feature(priv->vdev, VIRTIO_F_ANY_LAYOUT))
@@ -241,7 +320,7 @@ static int virtio_net_addbuffer(FAR struct netdev_lowerhalf_s *dev,
       vb[0].buf = &hdr->vhdr;
       vb[0].len = iov[0].iov_len + VIRTIO_NET_HDRSIZE;
 
-#if VIRTIO_NET_MAX_NIOB > 1
+#if VIRTIO_NET_MAX_NIOB > 1 || defined(CONFIG_DRIVERS_VIRTIO_NET_TSO)
       for (i = 1; i < iov_cnt; i++)
         {
           vb[i].buf = iov[i].iov_base;
@@ -286,10 +365,12 @@ static void virtio_net_rxfill(FAR struct netdev_lowerhalf_s *dev)
 {
   FAR struct virtio_net_priv_s *priv = (FAR struct virtio_net_priv_s *)dev;
   FAR struct virtqueue *vq = priv->vdev->vrings_info[VIRTIO_NET_RX].vq;
+  struct virtqueue_buf vb[VIRTIO_NET_MAX_NIOB + 1];
+  struct iovec iov[VIRTIO_NET_MAX_NIOB];
   FAR netpkt_t *pkt;
   int i;
 
-  for (i = 0; i < priv->bufnum; i++)
+  for (i = 0; i < priv->rxnum; i++)
     {
       /* IOB Offload, Alloc buffer from RX netpkt */
 
@@ -312,7 +393,8 @@ static void virtio_net_rxfill(FAR struct netdev_lowerhalf_s *dev)
 
       /* Add buffer to RX virtqueue */
 
-      virtio_net_addbuffer(dev, vq, pkt, VIRTIO_NET_RX);
+      virtio_net_addbuffer(dev, vq, pkt, VIRTIO_NET_RX,
+                           vb, iov, VIRTIO_NET_MAX_NIOB);
     }
 
   if (i > 0)
@@ -423,10 +505,20 @@ static int virtio_net_send(FAR struct netdev_lowerhalf_s *dev,
 {
   FAR struct virtio_net_priv_s *priv = (FAR struct virtio_net_priv_s *)dev;
   FAR struct virtqueue *vq = priv->vdev->vrings_info[VIRTIO_NET_TX].vq;
+  struct virtqueue_buf vb[VIRTIO_NET_TX_NIOB + 1];
+  struct iovec iov[VIRTIO_NET_TX_NIOB];
+  unsigned int maxlen = VIRTIO_NET_BUFSIZE;
+
+#ifdef CONFIG_DRIVERS_VIRTIO_NET_TSO
+  if (dev->netdev.d_gso_size > 0)
+    {
+      maxlen = NET_LL_HDRLEN(&dev->netdev) + dev->netdev.d_gso_max;
+    }
+#endif
 
   /* Check the send length */
 
-  if (netpkt_getdatalen(dev, pkt) > VIRTIO_NET_BUFSIZE)
+  if (netpkt_getdatalen(dev, pkt) > maxlen)
     {
       vrterr("net send buffer too large\n");
       return -EINVAL;
@@ -434,7 +526,8 @@ static int virtio_net_send(FAR struct netdev_lowerhalf_s *dev,
 
   /* Add buffer to vq and notify the other side */
 
-  virtio_net_addbuffer(dev, vq, pkt, VIRTIO_NET_TX);
+  virtio_net_addbuffer(dev, vq, pkt, VIRTIO_NET_TX,
+                       vb, iov, VIRTIO_NET_TX_NIOB);
   virtqueue_kick_lock(vq, &priv->lock[VIRTIO_NET_TX]);
 
   /* Try return Netpkt TX buffer to upper-half. */
@@ -560,6 +653,8 @@ static int virtio_net_init(FAR struct virtio_net_priv_s *priv,
 {
   FAR const char *vqnames[VIRTIO_NET_NUM];
   vq_callback callbacks[VIRTIO_NET_NUM];
+  int bufnum;
+  int descs;
   int ret;
 
   spin_lock_init(&priv->lock[VIRTIO_NET_RX]);
@@ -571,6 +666,11 @@ static int virtio_net_init(FAR struct virtio_net_priv_s *priv,
 
   virtio_set_status(vdev, VIRTIO_CONFIG_STATUS_DRIVER);
   virtio_negotiate_features(vdev, (1UL << VIRTIO_NET_F_MAC) |
+#ifdef CONFIG_DRIVERS_VIRTIO_NET_TSO
+                                  (1UL << VIRTIO_NET_F_CSUM) |
+                                  (1UL << VIRTIO_NET_F_HOST_TSO4) |
+                                  (1UL << VIRTIO_NET_F_HOST_TSO6) |
+#endif
                                   (1UL << VIRTIO_F_ANY_LAYOUT), NULL);
   virtio_set_status(vdev, VIRTIO_CONFIG_FEATURES_OK);
 
@@ -589,18 +689,59 @@ static int virtio_net_init(FAR struct virtio_net_priv_s *priv,
   virtio_set_status(vdev, VIRTIO_CONFIG_STATUS_DRIVER_OK);
 
 #if CONFIG_DRIVERS_VIRTIO_NET_BUFNUM > 0
-  priv->bufnum = CONFIG_DRIVERS_VIRTIO_NET_BUFNUM;
+  bufnum = CONFIG_DRIVERS_VIRTIO_NET_BUFNUM;
 #else
   /* Calculate the virtio network buffer number:
    * 1/4 for the TX netpkts, 1/4 for the RX netpkts.
    */
 
-  priv->bufnum = CONFIG_IOB_NBUFFERS / VIRTIO_NET_MAX_NIOB / 4;
+  bufnum = CONFIG_IOB_NBUFFERS / VIRTIO_NET_MAX_NIOB / 4;
 #endif
-  priv->bufnum = MIN(vdev->vrings_info[VIRTIO_NET_RX].info.num_descs /
-                     (VIRTIO_NET_MAX_NIOB + 1), priv->bufnum);
-  priv->bufnum = MIN(vdev->vrings_info[VIRTIO_NET_TX].info.num_descs /
-                     (VIRTIO_NET_MAX_NIOB + 1), priv->bufnum);
+
+  /* A packet takes up to VIRTIO_NET_MAX_NIOB descriptors plus one for the
+   * virtio net header.
+   */
+
+  descs = vdev->vrings_info[VIRTIO_NET_RX].info.num_descs;
+  priv->rxnum = MIN(descs / (VIRTIO_NET_MAX_NIOB + 1), bufnum);
+  descs = vdev->vrings_info[VIRTIO_NET_TX].info.num_descs;
+  priv->txnum = MIN(descs / (VIRTIO_NET_MAX_NIOB + 1), bufnum);
+
+#ifdef CONFIG_DRIVERS_VIRTIO_NET_TSO
+  /* A super-segment takes more descriptors.  Queue fewer TX packets and
+   * limit the super-segment size to the share of the TX ring each of them
+   * gets, falling back to software GSO if that is not above one frame.
+   */
+
+  if (priv->txnum > 0 && virtio_has_feature(vdev, VIRTIO_NET_F_CSUM) &&
+      (virtio_has_feature(vdev, VIRTIO_NET_F_HOST_TSO4) ||
+       virtio_has_feature(vdev, VIRTIO_NET_F_HOST_TSO6)))
+    {
+      FAR struct netdev_lowerhalf_s *netdev =
+        (FAR struct netdev_lowerhalf_s *)priv;
+      int txnum = MIN(priv->txnum, VIRTIO_NET_TSO_TXNUM);
+      int niob = MIN(descs / txnum - 1, VIRTIO_NET_TX_NIOB);
+      int maxlen = niob * CONFIG_IOB_BUFSIZE - CONFIG_NET_LL_GUARDSIZE;
+
+      if (maxlen > CONFIG_NET_ETH_PKTSIZE)
+        {
+          priv->txnum = txnum;
+          netdev->netdev.d_gso_max = MIN(maxlen,
+                                         CONFIG_NET_TCP_GSO_MAXSIZE);
+
+          if (virtio_has_feature(vdev, VIRTIO_NET_F_HOST_TSO4))
+            {
+              netdev->features |= NETDEV_F_TSO4;
+            }
+
+          if (virtio_has_feature(vdev, VIRTIO_NET_F_HOST_TSO6))
+            {
+              netdev->features |= NETDEV_F_TSO6;
+            }
+        }
+    }
+#endif
+
   return OK;
 }
 
@@ -668,8 +809,8 @@ static int virtio_net_probe(FAR struct virtio_device *vdev)
   /* Initialize the netdev lower half */
 
   netdev = (FAR struct netdev_lowerhalf_s *)priv;
-  netdev->quota[NETPKT_RX] = priv->bufnum;
-  netdev->quota[NETPKT_TX] = priv->bufnum;
+  netdev->quota[NETPKT_RX] = priv->rxnum;
+  netdev->quota[NETPKT_TX] = priv->txnum;
   netdev->ops = &g_virtio_net_ops;
 
 #ifdef CONFIG_DRIVERS_WIFI_SIM
@@ -42,6 +42,7 @@
 #if defined(CONFIG_FS_HEAPSIZE) && CONFIG_FS_HEAPSIZE > 0
 void      fs_heap_initialize(void);
 FAR void *fs_heap_zalloc(size_t size) malloc_like1(1);
+#  define fs_heap_zalloc_longlived fs_heap_zalloc
 FAR void *fs_heap_malloc(size_t size) malloc_like1(1);
 size_t    fs_heap_malloc_size(FAR void *mem);
 FAR void *fs_heap_realloc(FAR void *oldmem, size_t size) realloc_like(2);
@@ -55,6 +56,7 @@ struct mallinfo_task fs_heap_mallinfo_task(FAR const struct malltask *task);
 #else
 #  define fs_heap_initialize()
 #  define fs_heap_zalloc        kmm_zalloc
+#  define fs_heap_zalloc_longlived kmm_zalloc_longlived
 #  define fs_heap_malloc        kmm_malloc
 #  define fs_heap_malloc_size   kmm_malloc_size
 #  define fs_heap_realloc       kmm_realloc
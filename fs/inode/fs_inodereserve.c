@@ -84,7 +84,7 @@ static FAR struct inode *inode_alloc(FAR const char *name, mode_t mode)
   int namelen;
 
   namelen = inode_namelen(name);
-  inode   = fs_heap_zalloc(FSNODE_SIZE(namelen));
+  inode   = fs_heap_zalloc_longlived(FSNODE_SIZE(namelen));
   if (inode)
     {
       inode->i_ino   = g_ino++;
@@ -262,11 +262,16 @@ static ssize_t critmon_read_cpu(FAR struct critmon_file_s *attr,
 
   g_crit_max[cpu] = 0;
 
-  /* Generate output for maximum time in a critical section */
+  /* Generate output for maximum time in a critical section and for the
+   * number of times it was entered.
+   */
 
-  linesize = procfs_snprintf(attr->line, CRITMON_LINELEN, ",%lu.%09lu",
+  linesize = procfs_snprintf(attr->line, CRITMON_LINELEN,
+                             ",%lu.%09lu,%lu",
                              (unsigned long)maxtime.tv_sec,
-                             (unsigned long)maxtime.tv_nsec);
+                             (unsigned long)maxtime.tv_nsec,
+                             g_crit_count[cpu]);
+  g_crit_count[cpu] = 0;
   copysize = procfs_memcpy(attr->line, linesize, buffer, buflen, offset);
 
   totalsize += copysize;
@@ -187,6 +187,10 @@ static ssize_t iobinfo_read(FAR struct file *filep, FAR char *buffer,
   size_t copysize;
   size_t totalsize;
   off_t offset;
+#ifdef CONFIG_IOB_PERCPU
+  struct iob_cpustats_s cpustats;
+  int cpu;
+#endif
 
   finfo("buffer=%p buflen=%d\n", buffer, (int)buflen);
 
@@ -223,6 +227,37 @@ static ssize_t iobinfo_read(FAR struct file *filep, FAR char *buffer,
                              &offset);
   totalsize += copysize;
 
+#ifdef CONFIG_IOB_PERCPU
+  /* Then the header and one line for each of the per-CPU caches */
+
+  buffer    += copysize;
+  buflen    -= copysize;
+
+  linesize   = procfs_snprintf(iobfile->line, IOBINFO_LINELEN,
+                               "%10s%10s%10s%10s\n",
+                               "cpu", "ncached", "nalloc", "nfree");
+
+  copysize   = procfs_memcpy(iobfile->line, linesize, buffer, buflen,
+                             &offset);
+  totalsize += copysize;
+
+  for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      buffer    += copysize;
+      buflen    -= copysize;
+
+      iob_getcpustats(cpu, &cpustats);
+      linesize   = procfs_snprintf(iobfile->line, IOBINFO_LINELEN,
+                                   "%10d%10d%10lu%10lu\n",
+                                   cpu, cpustats.ncached,
+                                   cpustats.nalloc, cpustats.nfree);
+
+      copysize   = procfs_memcpy(iobfile->line, linesize, buffer, buflen,
+                                 &offset);
+      totalsize += copysize;
+    }
+#endif
+
   /* Update the file offset */
 
   filep->f_pos += totalsize;
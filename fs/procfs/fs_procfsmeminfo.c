@@ -31,6 +31,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <inttypes.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -62,6 +63,10 @@
 
 #define MEMINFO_LINELEN 512
 
+/* Longest " 0x..." frame printed by heapprof_line(), plus the newline */
+
+#define HEAPPROF_FRAMELEN (4 + 2 * sizeof(uintptr_t))
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -87,6 +92,20 @@ struct progmem_info_s
 };
 #endif
 
+#ifdef CONFIG_MM_HEAP_PROFILE
+/* This structure carries the read state across mm_profile() callbacks */
+
+struct heapprof_read_s
+{
+  FAR struct meminfo_file_s *procfile;
+  FAR char *buffer;               /* Remaining part of the user buffer */
+  size_t buflen;                  /* Remaining size of the user buffer */
+  size_t totalsize;               /* Number of bytes copied so far */
+  off_t offset;                   /* File offset left to skip */
+  struct mm_profsample_s total;   /* Sum of all call stacks */
+};
+#endif
+
 /****************************************************************************
  * Private Function Prototypes
  ****************************************************************************/
@@ -108,6 +127,10 @@ static ssize_t memdump_write(FAR struct file *filep, FAR const char *buffer,
 #endif
 static ssize_t meminfo_read(FAR struct file *filep, FAR char *buffer,
                  size_t buflen);
+#ifdef CONFIG_MM_HEAP_PROFILE
+static ssize_t heapprof_read(FAR struct file *filep, FAR char *buffer,
+                             size_t buflen);
+#endif
 static int     meminfo_dup(FAR const struct file *oldp,
                  FAR struct file *newp);
 static int     meminfo_stat(FAR const char *relpath, FAR struct stat *buf);
@@ -153,6 +176,23 @@ const struct procfs_operations g_memdump_operations =
 };
 #endif
 
+#ifdef CONFIG_MM_HEAP_PROFILE
+const struct procfs_operations g_heapprof_operations =
+{
+  meminfo_open,   /* open */
+  meminfo_close,  /* close */
+  heapprof_read,  /* read */
+  NULL,           /* write */
+  NULL,           /* poll */
+  meminfo_dup,    /* dup */
+  NULL,           /* opendir */
+  NULL,           /* closedir */
+  NULL,           /* readdir */
+  NULL,           /* rewinddir */
+  meminfo_stat    /* stat */
+};
+#endif
+
 static FAR struct procfs_meminfo_entry_s *g_procfs_meminfo = NULL;
 
 /****************************************************************************
@@ -345,6 +385,59 @@ static ssize_t meminfo_read(FAR struct file *filep, FAR char *buffer,
         }
     }
 
+#ifdef CONFIG_MM_HEAP_FRAGSTATS
+  /* Followed by the fragmentation of each heap: the fragmentation index,
+   * the smallest largest free chunk ever sampled and the recent samples,
+   * oldest first.
+   */
+
+  if (buflen > 0)
+    {
+      buffer    += copysize;
+      buflen    -= copysize;
+
+      linesize   = procfs_snprintf(procfile->line, MEMINFO_LINELEN,
+                                   "%6s%11s%s\n",
+                                   "frag", "minlargest",
+                                   " name: largest free history");
+      copysize   = procfs_memcpy(procfile->line, linesize, buffer, buflen,
+                                 &offset);
+      totalsize += copysize;
+    }
+
+  for (entry = g_procfs_meminfo; entry != NULL; entry = entry->next)
+    {
+      if (buflen > 0)
+        {
+          struct mm_fraginfo_s frag;
+          unsigned int i;
+
+          buffer    += copysize;
+          buflen    -= copysize;
+
+          mm_fraginfo(entry->heap, &frag);
+          linesize   = procfs_snprintf(procfile->line, MEMINFO_LINELEN,
+                                       "%5u%%%11lu %s:",
+                                       frag.index,
+                                       (unsigned long)frag.minlargest,
+                                       entry->name);
+          for (i = 0; i < frag.nhistory; i++)
+            {
+              linesize += procfs_snprintf(procfile->line + linesize,
+                                          MEMINFO_LINELEN - linesize,
+                                          " %lu",
+                                          (unsigned long)frag.history[i]);
+            }
+
+          linesize  += procfs_snprintf(procfile->line + linesize,
+                                       MEMINFO_LINELEN - linesize, "\n");
+          copysize   = procfs_memcpy(procfile->line, linesize, buffer,
+                                     buflen, &offset);
+          totalsize += copysize;
+        }
+    }
+#endif
+
 #ifdef CONFIG_MM_PGALLOC
   if (buflen > 0)
     {
@@ -645,6 +738,138 @@ dump:
 }
 #endif
 
+/****************************************************************************
+ * Name: heapprof_copy
+ ****************************************************************************/
+
+#ifdef CONFIG_MM_HEAP_PROFILE
+static void heapprof_copy(FAR struct heapprof_read_s *state,
+                          size_t linesize)
+{
+  size_t copysize;
+
+  copysize          = procfs_memcpy(state->procfile->line, linesize,
+                                    state->buffer, state->buflen,
+                                    &state->offset);
+  state->buffer    += copysize;
+  state->buflen    -= copysize;
+  state->totalsize += copysize;
+}
+
+/****************************************************************************
+ * Name: heapprof_sum
+ ****************************************************************************/
+
+static void heapprof_sum(FAR const struct mm_profsample_s *sample,
+                         FAR void *arg)
+{
+  FAR struct heapprof_read_s *state = arg;
+
+  state->total.inuseobjs  += sample->inuseobjs;
+  state->total.inusebytes += sample->inusebytes;
+  state->total.allocobjs  += sample->allocobjs;
+  state->total.allocbytes += sample->allocbytes;
+}
+
+/****************************************************************************
+ * Name: heapprof_line
+ ****************************************************************************/
+
+static void heapprof_line(FAR const struct mm_profsample_s *sample,
+                          FAR void *arg)
+{
+  FAR struct heapprof_read_s *state = arg;
+  FAR char *line = state->procfile->line;
+  size_t linesize;
+  unsigned int i;
+
+  if (state->buflen == 0)
+    {
+      return;
+    }
+
+  linesize = procfs_snprintf(line, MEMINFO_LINELEN,
+                             "%lu: %lu [%lu: %lu] @",
+                             (unsigned long)sample->inuseobjs,
+                             (unsigned long)sample->inusebytes,
+                             (unsigned long)sample->allocobjs,
+                             (unsigned long)sample->allocbytes);
+  for (i = 0; i < sample->depth; i++)
+    {
+      /* A deep stack does not fit in one line buffer, flush it early */
+
+      if (MEMINFO_LINELEN - linesize <= HEAPPROF_FRAMELEN)
+        {
+          heapprof_copy(state, linesize);
+          linesize = 0;
+        }
+
+      linesize += procfs_snprintf(line + linesize,
+                                  MEMINFO_LINELEN - linesize,
+                                  " 0x%" PRIxPTR,
+                                  (uintptr_t)sample->stack[i]);
+    }
+
+  linesize += procfs_snprintf(line + linesize, MEMINFO_LINELEN - linesize,
+                              "\n");
+  heapprof_copy(state, linesize);
+}
+
+/****************************************************************************
+ * Name: heapprof_read
+ *
+ * Description:
+ *   Print the call stacks of all heaps in the legacy heap profile text
+ *   format of pprof.  The counts are already scaled to estimate all
+ *   allocations, so the header carries no sampling period and pprof
+ *   reports them as they are.
+ *
+ ****************************************************************************/
+
+static ssize_t heapprof_read(FAR struct file *filep, FAR char *buffer,
+                             size_t buflen)
+{
+  FAR const struct procfs_meminfo_entry_s *entry;
+  struct heapprof_read_s state;
+  size_t linesize;
+
+  finfo("buffer=%p buflen=%d\n", buffer, (int)buflen);
+
+  DEBUGASSERT(buffer != NULL && buflen > 0);
+
+  memset(&state, 0, sizeof(state));
+  state.procfile = (FAR struct meminfo_file_s *)filep->f_priv;
+  state.buffer   = buffer;
+  state.buflen   = buflen;
+  state.offset   = filep->f_pos;
+  DEBUGASSERT(state.procfile);
+
+  for (entry = g_procfs_meminfo; entry != NULL; entry = entry->next)
+    {
+      mm_profile(entry->heap, heapprof_sum, &state);
+    }
+
+  linesize = procfs_snprintf(state.procfile->line, MEMINFO_LINELEN,
+                             "heap profile: %lu: %lu [%lu: %lu] "
+                             "@ heapprofile\n",
+                             (unsigned long)state.total.inuseobjs,
+                             (unsigned long)state.total.inusebytes,
+                             (unsigned long)state.total.allocobjs,
+                             (unsigned long)state.total.allocbytes);
+  heapprof_copy(&state, linesize);
+
+  for (entry = g_procfs_meminfo; entry != NULL; entry = entry->next)
+    {
+      mm_profile(entry->heap, heapprof_line, &state);
+    }
+
+  /* Update the file offset */
+
+  filep->f_pos += state.totalsize;
+  return state.totalsize;
+}
+#endif
+
 /****************************************************************************
  * Name: meminfo_dup
  *
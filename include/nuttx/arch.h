@@ -1279,6 +1279,29 @@ int up_addrenv_clone(FAR const arch_addrenv_t *src,
                      FAR arch_addrenv_t *dest);
 #endif
 
+/****************************************************************************
+ * Name: up_addrenv_fork
+ *
+ * Description:
+ *   Create a copy-on-write duplicate of an address environment for a
+ *   fork()'ed child.  The new address environment maps the same physical
+ *   pages as the source.  Writable pages are made read-only in both and
+ *   are copied by the page fault handler on the first write.  The source
+ *   must be the address environment that is currently selected.
+ *
+ * Input Parameters:
+ *   src - The address environment of the parent.
+ *   dest - The location to receive the new address environment.
+ *
+ * Returned Value:
+ *   Zero (OK) on success; a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_ARCH_ADDRENV_COW
+int up_addrenv_fork(FAR arch_addrenv_t *src, FAR arch_addrenv_t *dest);
+#endif
+
 /****************************************************************************
  * Name: up_addrenv_attach
  *
@@ -113,6 +113,22 @@ extern "C"
 
 #endif
 
+/* Memory kept for a long time, such as task control blocks and driver
+ * state, is allocated with a hint so that the heap can place it away from
+ * short-lived allocations.
+ */
+
+#if !defined(CONFIG_MM_HEAP_LIFETIME)
+#  define kmm_malloc_longlived(s) kmm_malloc(s)
+#  define kmm_zalloc_longlived(s) kmm_zalloc(s)
+#elif !defined(CONFIG_MM_KERNEL_HEAP) && defined(CONFIG_BUILD_FLAT)
+#  define kmm_malloc_longlived(s) mm_malloc_longlived(g_mmheap, s)
+#  define kmm_zalloc_longlived(s) mm_zalloc_longlived(g_mmheap, s)
+#elif !defined(CONFIG_MM_KERNEL_HEAP)
+#  define kmm_malloc_longlived(s) malloc(s)
+#  define kmm_zalloc_longlived(s) zalloc(s)
+#endif
+
 #ifdef CONFIG_MM_KERNEL_HEAP
 /****************************************************************************
  * Group memory management
@@ -0,0 +1,145 @@
+/****************************************************************************
+ * include/nuttx/mm/arena.h
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_NUTTX_MM_ARENA_H
+#define __INCLUDE_NUTTX_MM_ARENA_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+
+#include <nuttx/mm/mm.h>
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* An arena hands out memory by bumping a pointer through chunks obtained
+ * from a heap.  Individual objects are never freed; all of them are
+ * released together by arena_reset() or arena_destroy().  This suits
+ * operations that build several short-lived objects and drop them at once.
+ */
+
+struct arena_s;
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#undef EXTERN
+#if defined(__cplusplus)
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Name: arena_create
+ *
+ * Description:
+ *   Create an arena.  The first chunk is allocated together with the arena
+ *   itself, so an operation whose objects fit into initsize bytes costs a
+ *   single heap allocation.
+ *
+ * Input Parameters:
+ *   heap      - The heap that backs the arena.  NULL selects the default
+ *               heap of the caller, i.e. the kernel heap inside the kernel
+ *               and the user heap otherwise.
+ *   initsize  - The size of the first chunk in bytes.
+ *   chunksize - The size of each further chunk in bytes.  Larger requests
+ *               get a chunk of their own.
+ *
+ * Returned Value:
+ *   The arena on success; NULL if the memory could not be allocated.
+ *
+ ****************************************************************************/
+
+FAR struct arena_s *arena_create(FAR struct mm_heap_s *heap,
+                                 size_t initsize, size_t chunksize);
+
+/****************************************************************************
+ * Name: arena_alloc
+ *
+ * Description:
+ *   Allocate size bytes from the arena.  The memory is aligned like heap
+ *   memory and is not initialized.
+ *
+ * Input Parameters:
+ *   arena - The arena to allocate from.
+ *   size  - The number of bytes to allocate.
+ *
+ * Returned Value:
+ *   The allocated memory on success; NULL on failure.
+ *
+ ****************************************************************************/
+
+FAR void *arena_alloc(FAR struct arena_s *arena, size_t size);
+
+/****************************************************************************
+ * Name: arena_zalloc
+ *
+ * Description:
+ *   Same as arena_alloc(), but the memory is cleared.
+ *
+ ****************************************************************************/
+
+FAR void *arena_zalloc(FAR struct arena_s *arena, size_t size);
+
+/****************************************************************************
+ * Name: arena_reset
+ *
+ * Description:
+ *   Release every object allocated from the arena.  The first chunk is
+ *   kept so that the arena can be reused without touching the heap.
+ *
+ * Input Parameters:
+ *   arena - The arena to reset.
+ *
+ ****************************************************************************/
+
+void arena_reset(FAR struct arena_s *arena);
+
+/****************************************************************************
+ * Name: arena_destroy
+ *
+ * Description:
+ *   Release every object allocated from the arena and the arena itself.
+ *
+ * Input Parameters:
+ *   arena - The arena to destroy.  NULL is ignored.
+ *
+ ****************************************************************************/
+
+void arena_destroy(FAR struct arena_s *arena);
+
+#undef EXTERN
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* __INCLUDE_NUTTX_MM_ARENA_H */
@@ -32,6 +32,10 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#ifdef CONFIG_IOB_ALLOC
+#  include <nuttx/atomic.h>
+#endif
+
 #ifdef CONFIG_IOB_NOTIFIER
 #  include <nuttx/wqueue.h>
 #endif
@@ -102,6 +106,21 @@
 
 typedef CODE void (*iob_free_cb_t)(FAR void *data);
 
+#ifdef CONFIG_IOB_ALLOC
+/* Describes a driver owned buffer (typically DMA memory) that backs one or
+ * more I/O buffers without copying.  The buffer is handed back through
+ * eb_free once the owner and every I/O buffer referencing it have dropped
+ * their reference.
+ */
+
+struct iob_extbuf_s
+{
+  FAR uint8_t  *eb_data;  /* Start of the external buffer */
+  iob_free_cb_t eb_free;  /* Return the buffer to its owner */
+  atomic_t      eb_refs;  /* Number of references held */
+};
+#endif
+
 /* Represents one I/O buffer.  A packet is contained by one or more I/O
  * buffers in a chain.  The io_pktlen is only valid for the I/O buffer at
  * the head of the chain.
@@ -170,6 +189,15 @@ struct iob_stats_s
   int nthrottle;
 };
 
+#ifdef CONFIG_IOB_PERCPU
+struct iob_cpustats_s
+{
+  int ncached;              /* I/O buffers held in the cache */
+  unsigned long nalloc;     /* Allocations served from the cache */
+  unsigned long nfree;      /* Frees absorbed by the cache */
+};
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -266,6 +294,62 @@ FAR struct iob_s *iob_alloc_dynamic(uint16_t size);
 
 FAR struct iob_s *iob_alloc_with_data(FAR void *data, uint16_t size,
                                       iob_free_cb_t free_cb);
+
+/****************************************************************************
+ * Name: iob_extbuf_init
+ *
+ * Description:
+ *   Prepare an external buffer for sharing with I/O buffers.  The caller
+ *   holds the initial reference and must drop it with iob_extbuf_put()
+ *   once it has wrapped all the I/O buffers it needs.
+ *
+ * Input Parameters:
+ *   ext     - The external buffer descriptor, owned by the caller
+ *   data    - The start of the external buffer
+ *   free_cb - Called with data when the last reference is dropped
+ *
+ ****************************************************************************/
+
+void iob_extbuf_init(FAR struct iob_extbuf_s *ext, FAR void *data,
+                     iob_free_cb_t free_cb);
+
+/****************************************************************************
+ * Name: iob_extbuf_put
+ *
+ * Description:
+ *   Drop one reference to an external buffer, returning the buffer to its
+ *   owner if that was the last one.
+ *
+ ****************************************************************************/
+
+void iob_extbuf_put(FAR struct iob_extbuf_s *ext);
+
+/****************************************************************************
+ * Name: iob_alloc_extbuf
+ *
+ * Description:
+ *   Allocate an I/O buffer whose payload is a slice of an external buffer.
+ *   The I/O buffer holds a reference to the external buffer until it is
+ *   freed, so several I/O buffers may share one external buffer.
+ *
+ *             +---------+      +-----------------+
+ *             |   IOB   |      | external buffer |
+ *             | io_data |--+   +-----------------+
+ *             +---------+  +-->|      slice      |
+ *                              +-----------------+
+ *
+ * Input Parameters:
+ *   ext    - The external buffer
+ *   offset - Offset of the slice in the external buffer
+ *   size   - The size of the slice
+ *
+ * Returned Value:
+ *   An empty I/O buffer covering the slice, or NULL on failure.
+ *
+ ****************************************************************************/
+
+FAR struct iob_s *iob_alloc_extbuf(FAR struct iob_extbuf_s *ext,
+                                   uint16_t offset, uint16_t size);
 #endif
 
 /****************************************************************************
@@ -683,5 +767,21 @@ void iob_dump(FAR const char *msg, FAR struct iob_s *iob, unsigned int len,
 void iob_getstats(FAR struct iob_stats_s *stats);
 #endif
 
+/****************************************************************************
+ * Name: iob_getcpustats
+ *
+ * Description:
+ *   Return the statistics of the I/O buffer cache of one CPU.
+ *
+ * Input Parameters:
+ *   cpu   - The CPU whose cache is queried
+ *   stats - Location to return the statistics
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_IOB_PERCPU
+void iob_getcpustats(int cpu, FAR struct iob_cpustats_s *stats);
+#endif
+
 #endif /* CONFIG_MM_IOB */
 #endif /* __INCLUDE_NUTTX_MM_IOB_H */
@@ -87,6 +87,17 @@ struct mempool_procfs_entry_s
 };
 #endif
 
+#ifdef CONFIG_MM_MEMPOOL_PERCPU
+/* The free blocks of a memory pool cached by one CPU */
+
+struct mempool_percpu_s
+{
+  sq_queue_t queue;   /* The free block queue of this CPU */
+  size_t     nfree;   /* The number of blocks in queue */
+  spinlock_t lock;    /* Taken by other CPUs to drain the queue */
+};
+#endif
+
 /* This structure describes memory buffer pool */
 
 struct mempool_s
@@ -110,6 +121,9 @@ struct mempool_s
   size_t     nalloc;  /* The number of used block in mempool */
   spinlock_t lock;    /* The protect lock to mempool */
   sem_t      waitsem; /* The semaphore of waiter get free block */
+#ifdef CONFIG_MM_MEMPOOL_PERCPU
+  struct mempool_percpu_s percpu[CONFIG_SMP_NCPUS]; /* Per-CPU free blocks */
+#endif
 #if defined(CONFIG_FS_PROCFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_MEMPOOL)
   struct mempool_procfs_entry_s procfs; /* The entry of procfs */
 #endif
@@ -203,6 +217,42 @@ FAR void *mempool_allocate(FAR struct mempool_s *pool);
 
 void mempool_release(FAR struct mempool_s *pool, FAR void *blk);
 
+/****************************************************************************
+ * Name: mempool_allocate_batch
+ *
+ * Description:
+ *   Allocate up to nblks blocks from a specific memory pool, taking the
+ *   pool lock only once.  Blocks are only taken from the free queue; the
+ *   pool is never expanded and the caller never blocks.
+ *
+ * Input Parameters:
+ *   pool  - Address of the memory pool to be used.
+ *   blks  - The array that receives the allocated blocks.
+ *   nblks - The maximum number of blocks to allocate.
+ *
+ * Returned Value:
+ *   The number of blocks stored in blks; zero if the queue is empty.
+ ****************************************************************************/
+
+size_t mempool_allocate_batch(FAR struct mempool_s *pool,
+                              FAR void **blks, size_t nblks);
+
+/****************************************************************************
+ * Name: mempool_release_batch
+ *
+ * Description:
+ *   Release nblks memory blocks to the pool, taking the pool lock only
+ *   once.
+ *
+ * Input Parameters:
+ *   pool  - Address of the memory pool to be used.
+ *   blks  - The array of memory blocks.
+ *   nblks - The number of blocks in blks.
+ ****************************************************************************/
+
+void mempool_release_batch(FAR struct mempool_s *pool,
+                           FAR void * const *blks, size_t nblks);
+
 /****************************************************************************
  * Name: mempool_info
  *
@@ -182,6 +182,42 @@ struct mempool_init_s
   size_t            dict_expendsize;
 };
 
+#ifdef CONFIG_MM_HEAP_FRAGSTATS
+/* Fragmentation statistics of one heap */
+
+struct mm_fraginfo_s
+{
+  size_t       free;       /* Total size of the free memory */
+  size_t       largest;    /* Size of the largest free chunk */
+  size_t       minlargest; /* Smallest largest free chunk ever sampled */
+  unsigned int index;      /* Fragmentation index in percent */
+  unsigned int nhistory;   /* Number of valid entries in history[] */
+
+  /* The sampled largest free chunk sizes, oldest first */
+
+  size_t       history[CONFIG_MM_HEAP_FRAGSTATS_HISTORY];
+};
+#endif
+
+#ifdef CONFIG_MM_HEAP_PROFILE
+/* One call stack of the heap profile.  The counts are estimates of all
+ * allocations made from the call stack, scaled from the samples.
+ */
+
+struct mm_profsample_s
+{
+  size_t       allocobjs;  /* Objects allocated since boot */
+  size_t       allocbytes; /* Bytes allocated since boot */
+  size_t       inuseobjs;  /* Objects not yet freed */
+  size_t       inusebytes; /* Bytes not yet freed */
+  unsigned int depth;      /* Number of valid entries in stack[] */
+  FAR void    *stack[CONFIG_MM_HEAP_PROFILE_DEPTH];
+};
+
+typedef CODE void (*mm_profile_handler_t)
+  (FAR const struct mm_profsample_s *sample, FAR void *arg);
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -284,10 +320,18 @@ FAR void *mm_malloc(FAR struct mm_heap_s *heap, size_t size) malloc_like1(2);
 
 void mm_free_delaylist(FAR struct mm_heap_s *heap);
 
+#ifdef CONFIG_MM_HEAP_LIFETIME
+FAR void *mm_malloc_longlived(FAR struct mm_heap_s *heap, size_t size)
+                              malloc_like1(2);
+#endif
+
 /* Functions contained in kmm_malloc.c **************************************/
 
 #ifdef CONFIG_MM_KERNEL_HEAP
 FAR void *kmm_malloc(size_t size) malloc_like1(1);
+#  ifdef CONFIG_MM_HEAP_LIFETIME
+FAR void *kmm_malloc_longlived(size_t size) malloc_like1(1);
+#  endif
 #endif
 
 /* Functions contained in mm_malloc_size.c **********************************/
@@ -336,10 +380,18 @@ FAR void *kmm_calloc(size_t n, size_t elem_size) malloc_like2(1, 2);
 
 FAR void *mm_zalloc(FAR struct mm_heap_s *heap, size_t size) malloc_like1(2);
 
+#ifdef CONFIG_MM_HEAP_LIFETIME
+FAR void *mm_zalloc_longlived(FAR struct mm_heap_s *heap, size_t size)
+                              malloc_like1(2);
+#endif
+
 /* Functions contained in kmm_zalloc.c **************************************/
 
 #ifdef CONFIG_MM_KERNEL_HEAP
 FAR void *kmm_zalloc(size_t size) malloc_like1(1);
+#  ifdef CONFIG_MM_HEAP_LIFETIME
+FAR void *kmm_zalloc_longlived(size_t size) malloc_like1(1);
+#  endif
 #endif
 
 /* Functions contained in kmm_memdump.c *************************************/
@@ -411,6 +463,18 @@ struct mallinfo_task mm_mallinfo_task(FAR struct mm_heap_s *heap,
 size_t mm_heapfree(FAR struct mm_heap_s *heap);
 size_t mm_heapfree_largest(FAR struct mm_heap_s *heap);
 
+#ifdef CONFIG_MM_HEAP_FRAGSTATS
+void mm_fraginfo(FAR struct mm_heap_s *heap,
+                 FAR struct mm_fraginfo_s *info);
+#endif
+
+/* Functions contained in mm_profile.c **************************************/
+
+#ifdef CONFIG_MM_HEAP_PROFILE
+void mm_profile(FAR struct mm_heap_s *heap, mm_profile_handler_t handler,
+                FAR void *arg);
+#endif
+
 /* Functions contained in kmm_mallinfo.c ************************************/
 
 #ifdef CONFIG_MM_KERNEL_HEAP
@@ -505,6 +505,17 @@ static inline_function int nxmutex_lock(FAR mutex_t *mutex)
 {
   int ret;
 
+#if defined(CONFIG_MUTEX_ADAPTIVE_SPIN) && \
+    (defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__))
+  /* Spin briefly if the holder is running on another CPU */
+
+  if (nxsem_spinwait(&mutex->sem))
+    {
+      nxmutex_add_backtrace(mutex);
+      return OK;
+    }
+#endif
+
   ret = nxsem_wait(&mutex->sem);
   if (ret >= 0)
     {
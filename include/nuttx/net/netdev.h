@@ -474,6 +474,17 @@ struct net_driver_s
 
   uint16_t d_sndlen;
 
+#ifdef CONFIG_NET_TCP_GSO
+  /* TCP segmentation offload.  d_gso_max is the largest IP packet the
+   * driver accepts for segmentation, 0 if not supported.  d_gso_size is
+   * the MSS to segment the outgoing TCP packet in d_iob with, 0 if it is
+   * a regular packet.
+   */
+
+  uint16_t d_gso_max;
+  uint16_t d_gso_size;
+#endif
+
   /* Multicast group support */
 
 #ifdef CONFIG_NET_IGMP
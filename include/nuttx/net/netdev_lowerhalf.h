@@ -72,6 +72,11 @@
 #define NETPKT_BUFLEN   CONFIG_IOB_BUFSIZE
 #define NETPKT_BUFNUM   CONFIG_IOB_NBUFFERS
 
+/* Segmentation offloads of the lower half, see features below */
+
+#define NETDEV_F_TSO4   (1 << 0) /* Segments TCP over IPv4 */
+#define NETDEV_F_TSO6   (1 << 1) /* Segments TCP over IPv6 */
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -119,6 +124,14 @@ struct netdev_lowerhalf_s
 
   atomic_t quota[NETPKT_TYPENUM];
 
+#ifdef CONFIG_NET_TCP_GSO
+  /* NETDEV_F_* offloads, super-segments of the other kinds are split by
+   * the upper half before transmit.
+   */
+
+  uint32_t features;
+#endif
+
   /* The structure used by net stack.
    * Note: Do not change its fields unless you know what you are doing.
    *
@@ -146,6 +159,9 @@ struct netdev_ops_s
    *       own queue and return OK (remember to free it later).
    *     Negated errno value for failure, will stop current sending, the pkt
    *       will be recycled by upper half.
+   *   With NETDEV_F_TSO4/6, netdev.d_gso_size is the MSS to segment pkt
+   *   with, 0 for a regular packet.  Its TCP checksum then only covers the
+   *   pseudo-header, for the hardware to complete.
    */
 
   CODE int (*transmit)(FAR struct netdev_lowerhalf_s *dev,
@@ -340,6 +356,42 @@ void netdev_lower_txdone(FAR struct netdev_lowerhalf_s *dev);
 FAR netpkt_t *netpkt_alloc(FAR struct netdev_lowerhalf_s *dev,
                            enum netpkt_type_e type);
 
+/****************************************************************************
+ * Name: netpkt_wrap
+ *
+ * Description:
+ *   Wrap a frame that lives in a driver owned buffer (e.g. a DMA receive
+ *   buffer) as a netpkt without copying it.  The netpkt holds a reference
+ *   to the external buffer, which is handed back to the driver through its
+ *   free callback once the stack is done with every packet wrapping it.
+ *   The packet is released with netpkt_free() like any other.
+ *
+ *   The wrapped netpkt has the layout of one from netpkt_alloc(), so that
+ *   the stack can build a reply in place: the driver must leave
+ *   CONFIG_NET_LL_GUARDSIZE minus the L2 header length of headroom in
+ *   front of the frame, and the headroom plus size must be at least
+ *   CONFIG_IOB_BUFSIZE.
+ *
+ * Input Parameters:
+ *   dev    - The lower half device driver structure
+ *   ext    - The external buffer, see iob_extbuf_init()
+ *   offset - Offset of the frame (starting with the L2 header) in ext
+ *   len    - Length of the frame, including the L2 header
+ *   size   - Room for the frame from offset on, at least len
+ *   type   - Whether used for TX or RX
+ *
+ * Returned Value:
+ *   Pointer to the packet, NULL on failure
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_IOB_ALLOC
+FAR netpkt_t *netpkt_wrap(FAR struct netdev_lowerhalf_s *dev,
+                          FAR struct iob_extbuf_s *ext,
+                          unsigned int offset, unsigned int len,
+                          unsigned int size, enum netpkt_type_e type);
+#endif
+
 /****************************************************************************
  * Name: netpkt_free
  *
@@ -204,6 +204,59 @@ uintptr_t mm_pgalloc_align(unsigned int npages, unsigned int align);
 
 void mm_pgfree(uintptr_t paddr, unsigned int npages);
 
+#ifdef CONFIG_MM_PGALLOC_REFCOUNT
+/****************************************************************************
+ * Name: mm_pgref
+ *
+ * Description:
+ *   Take an additional reference to a page that is about to be mapped a
+ *   second time, e.g. by a copy-on-write clone of an address environment.
+ *
+ * Input Parameters:
+ *   paddr - The physical address of a page allocated by mm_pgalloc.
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void mm_pgref(uintptr_t paddr);
+
+/****************************************************************************
+ * Name: mm_pgunref
+ *
+ * Description:
+ *   Drop one reference to a page.  The page is returned to the page memory
+ *   pool when its last reference is dropped.
+ *
+ * Input Parameters:
+ *   paddr - The physical address of a page allocated by mm_pgalloc.
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void mm_pgunref(uintptr_t paddr);
+
+/****************************************************************************
+ * Name: mm_pgrefs
+ *
+ * Description:
+ *   Return the number of references to a page.  A freshly allocated page
+ *   has one reference.
+ *
+ * Input Parameters:
+ *   paddr - The physical address of a page allocated by mm_pgalloc.
+ *
+ * Returned Value:
+ *   The number of references to the page.
+ *
+ ****************************************************************************/
+
+unsigned int mm_pgrefs(uintptr_t paddr);
+#endif
+
 /****************************************************************************
  * Name: mm_pginfo
  *
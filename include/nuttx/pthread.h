@@ -96,6 +96,14 @@
   }
 #endif
 
+/* The semaphore underlying a pthread mutex */
+
+#ifdef CONFIG_PTHREAD_MUTEX_TYPES
+#  define PTHREAD_MUTEX_SEM(m) (&(m)->mutex.mutex.sem)
+#else
+#  define PTHREAD_MUTEX_SEM(m) (&(m)->mutex.sem)
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -164,6 +172,71 @@ int nx_pthread_create(pthread_trampoline_t trampoline, FAR pthread_t *thread,
 
 void nx_pthread_exit(FAR void *exit_value) noreturn_function;
 
+/****************************************************************************
+ * Name: nx_pthread_mutex_unlock, nx_pthread_cond_signal and
+ *       nx_pthread_cond_broadcast
+ *
+ * Description:
+ *   The OS side of pthread_mutex_unlock(), pthread_cond_signal() and
+ *   pthread_cond_broadcast().  The C library wrappers only call these when
+ *   the operation cannot be completed in user memory.
+ *
+ * Returned Value:
+ *   OK (0) on success; a (non-negated) errno value on failure. The errno
+ *   variable is not set.
+ *
+ ****************************************************************************/
+
+int nx_pthread_mutex_unlock(FAR pthread_mutex_t *mutex);
+int nx_pthread_cond_signal(FAR pthread_cond_t *cond);
+int nx_pthread_cond_broadcast(FAR pthread_cond_t *cond);
+
+/****************************************************************************
+ * Name: pthread_mutex_fastpath
+ *
+ * Description:
+ *   Return true if the mutex can be locked and unlocked with a single
+ *   atomic operation on the holder word in user memory.  This is the case
+ *   for the non-robust NORMAL mutex without priority protection:  Nothing
+ *   but the holder has to be tracked for it, so the OS only needs to be
+ *   entered to wait for the mutex or to wake up a waiter.
+ *
+ * Input Parameters:
+ *   mutex - The mutex to be checked
+ *
+ * Returned Value:
+ *   True if the user space fast path may be used.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_PTHREAD_FASTPATH
+static inline_function bool pthread_mutex_fastpath(FAR pthread_mutex_t *mutex)
+{
+#ifdef CONFIG_PTHREAD_MUTEX_BOTH
+  if ((mutex->flags & _PTHREAD_MFLAGS_ROBUST) != 0)
+    {
+      return false;
+    }
+#endif
+
+#ifdef CONFIG_PTHREAD_MUTEX_TYPES
+  if (mutex->type != PTHREAD_MUTEX_NORMAL)
+    {
+      return false;
+    }
+#endif
+
+#ifdef CONFIG_PRIORITY_PROTECT
+  if ((PTHREAD_MUTEX_SEM(mutex)->flags & SEM_PRIO_MASK) == SEM_PRIO_PROTECT)
+    {
+      return false;
+    }
+#endif
+
+  return true;
+}
+#endif
+
 #undef EXTERN
 #ifdef __cplusplus
 }
@@ -98,6 +98,7 @@
 #  define TCB_FLAG_SCHED_FIFO      (0 << TCB_FLAG_POLICY_SHIFT)  /* FIFO scheding policy */
 #  define TCB_FLAG_SCHED_RR        (1 << TCB_FLAG_POLICY_SHIFT)  /* Round robin scheding policy */
 #  define TCB_FLAG_SCHED_SPORADIC  (2 << TCB_FLAG_POLICY_SHIFT)  /* Sporadic scheding policy */
+#  define TCB_FLAG_SCHED_DEADLINE  (3 << TCB_FLAG_POLICY_SHIFT)  /* Deadline scheding policy */
 #define TCB_FLAG_CPU_LOCKED        (1 << 5)                      /* Bit 5: Locked to this CPU */
 #define TCB_FLAG_SIGNAL_ACTION     (1 << 6)                      /* Bit 6: In a signal handler */
 #define TCB_FLAG_SYSCALL           (1 << 7)                      /* Bit 7: In a system call */
@@ -343,6 +344,28 @@ struct sporadic_s
 
 #endif /* CONFIG_SCHED_SPORADIC */
 
+/* struct deadline_s ********************************************************/
+
+#ifdef CONFIG_SCHED_DEADLINE
+
+/* This structure holds the SCHED_DEADLINE parameters and the state of the
+ * current job of a thread.  All times are in clock ticks.
+ */
+
+struct deadline_s
+{
+  clock_t   runtime;                /* Execution budget per period           */
+  clock_t   deadline;               /* Relative deadline of each job         */
+  clock_t   period;                 /* Activation period                     */
+  clock_t   absdeadline;            /* Absolute deadline of the current job  */
+  clock_t   release;                /* Release time of the next job          */
+  uint32_t  bandwidth;              /* Admitted runtime / period (Q20)       */
+  uint32_t  misses;                 /* Number of missed deadlines            */
+  uint32_t  overruns;               /* Number of exhausted budgets           */
+};
+
+#endif /* CONFIG_SCHED_DEADLINE */
+
 /* struct child_status_s ****************************************************/
 
 /* This structure is used to maintain information about child tasks.
@@ -618,15 +641,22 @@ struct tcb_s
 #endif
   int16_t  errcode;                      /* Used to pass error information  */
 
-#if CONFIG_RR_INTERVAL > 0 || defined(CONFIG_SCHED_SPORADIC)
-  int32_t  timeslice;                    /* RR timeslice OR Sporadic budget */
-                                         /* interval remaining              */
+#if CONFIG_RR_INTERVAL > 0 || defined(CONFIG_SCHED_SPORADIC) || \
+    defined(CONFIG_SCHED_DEADLINE)
+  int32_t  timeslice;                    /* RR timeslice OR Sporadic or     */
+                                         /* Deadline budget remaining       */
 #endif
 #ifdef CONFIG_SCHED_SPORADIC
   FAR struct sporadic_s *sporadic;       /* Sporadic scheduling parameters  */
 #endif
+#ifdef CONFIG_SCHED_DEADLINE
+  struct deadline_s dl;                  /* Deadline scheduling parameters  */
+#endif
 
   struct wdog_s waitdog;                 /* All timed waits use this timer  */
+#ifdef CONFIG_WDOG_TIMER_SLACK
+  clock_t  timerslack;                   /* Slack of timed waits in ticks   */
+#endif
 
   /* Stack-Related Fields ***************************************************/
 
@@ -845,6 +875,7 @@ EXTERN clock_t g_preemp_max[CONFIG_SMP_NCPUS];
 
 #if CONFIG_SCHED_CRITMONITOR_MAXTIME_CSECTION >= 0
 EXTERN clock_t g_crit_max[CONFIG_SMP_NCPUS];
+EXTERN unsigned long g_crit_count[CONFIG_SMP_NCPUS];
 #endif /* CONFIG_SCHED_CRITMONITOR_MAXTIME_CSECTION >= 0 */
 
 /* g_running_tasks[] holds a references to the running task for each CPU.
@@ -42,12 +42,12 @@
 
 #ifdef CONFIG_PRIORITY_INHERITANCE
 #  if CONFIG_SEM_PREALLOCHOLDERS > 0
-/* semcount, flags, waitlist, hhead */
+/* semcount, flags, waitlist, holder, hhead */
 
 #    define NXSEM_INITIALIZER(c, f) \
-       {{(c)}, (f), SEM_WAITLIST_INITIALIZER, NULL}
+       {{(c)}, (f), SEM_WAITLIST_INITIALIZER, SEMHOLDER_INITIALIZER, NULL}
 #  else
-/* semcount, flags, waitlist, holder[2] */
+/* semcount, flags, waitlist, holder */
 
 #    define NXSEM_INITIALIZER(c, f) \
        {{(c)}, (f), SEM_WAITLIST_INITIALIZER, SEMHOLDER_INITIALIZER}
@@ -233,6 +233,27 @@ int nxsem_wait_slow(FAR sem_t *sem);
 int nxsem_trywait(FAR sem_t *sem);
 int nxsem_trywait_slow(FAR sem_t *sem);
 
+/****************************************************************************
+ * Name: nxsem_spinwait
+ *
+ * Description:
+ *   Try to take a mutex type semaphore by busy waiting for a bounded time
+ *   while its holder is running on another CPU.  The caller must fall back
+ *   to nxsem_wait() if the mutex could not be taken.
+ *
+ * Input Parameters:
+ *   sem - the semaphore descriptor
+ *
+ * Returned Value:
+ *   True if the mutex was taken; false otherwise.
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_MUTEX_ADAPTIVE_SPIN) && \
+    (defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__))
+bool nxsem_spinwait(FAR sem_t *sem);
+#endif
+
 /****************************************************************************
  * Name: nxsem_timedwait
  *
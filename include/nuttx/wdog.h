@@ -97,6 +97,9 @@ struct wdog_s
   FAR void          *picbase;    /* PIC base address */
 #endif
   clock_t            expired;    /* Timer associated with the absolute time */
+#ifdef CONFIG_WDOG_TIMER_SLACK
+  clock_t            slack;      /* Ticks the expiration may be deferred */
+#endif
 };
 
 /****************************************************************************
@@ -332,6 +335,38 @@ int wd_start_next(FAR struct wdog_s *wdog, clock_t delay,
   return wd_start_abstick(wdog, wdog->expired + delay, wdentry, arg);
 }
 
+/****************************************************************************
+ * Name: wd_start_slack
+ *
+ * Description:
+ *   Same as wd_start(), but the watchdog may expire up to 'slack' ticks
+ *   after the requested delay.  This allows the tickless timer to handle
+ *   the expiration together with other nearby watchdogs in a single timer
+ *   interrupt.
+ *
+ * Input Parameters:
+ *   wdog     - Watchdog ID
+ *   delay    - Delay count in clock ticks
+ *   slack    - Maximum additional delay in clock ticks
+ *   wdentry  - Function to call on timeout
+ *   arg      - Parameter to pass to wdentry.
+ *
+ *   NOTE:  The parameter must be of type wdparm_t.
+ *
+ * Returned Value:
+ *   Zero (OK) is returned on success; a negated errno value is return to
+ *   indicate the nature of any failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_WDOG_TIMER_SLACK
+int wd_start_slack(FAR struct wdog_s *wdog, clock_t delay, clock_t slack,
+                   wdentry_t wdentry, wdparm_t arg);
+#else
+#  define wd_start_slack(wdog, delay, slack, wdentry, arg) \
+          wd_start(wdog, delay, wdentry, arg)
+#endif
+
 /****************************************************************************
  * Name: wd_cancel
  *
@@ -253,6 +253,9 @@ struct work_s
   clock_t          qtime;  /* Time work queued */
   worker_t         worker; /* Work callback */
   FAR void        *arg;    /* Callback argument */
+#ifdef CONFIG_SCHED_HPWORK_PERCPU
+  FAR struct kwork_wqueue_s *wq; /* Queue the work was last queued to */
+#endif
 };
 
 /* This is an enumeration of the various events that may be
@@ -124,10 +124,9 @@ struct sem_s
   dq_queue_t waitlist;
 
 #ifdef CONFIG_PRIORITY_INHERITANCE
+  struct semholder_s holder;     /* Built-in slot for the first holder */
 #  if CONFIG_SEM_PREALLOCHOLDERS > 0
-  FAR struct semholder_s *hhead; /* List of holders of semaphore counts */
-#  else
-  struct semholder_s holder;     /* Slot for old and new holder */
+  FAR struct semholder_s *hhead; /* List of additional holders */
 #  endif
 #endif
 #ifdef CONFIG_PRIORITY_PROTECT
@@ -142,12 +141,12 @@ typedef struct sem_s sem_t;
 
 #ifdef CONFIG_PRIORITY_INHERITANCE
 #  if CONFIG_SEM_PREALLOCHOLDERS > 0
-/* semcount, flags, waitlist, hhead */
+/* semcount, flags, waitlist, holder, hhead */
 
 #    define SEM_INITIALIZER(c) \
-       {{(c)}, 0, SEM_WAITLIST_INITIALIZER, NULL}
+       {{(c)}, 0, SEM_WAITLIST_INITIALIZER, SEMHOLDER_INITIALIZER, NULL}
 #  else
-/* semcount, flags, waitlist, holder[2] */
+/* semcount, flags, waitlist, holder */
 
 #    define SEM_INITIALIZER(c) \
        {{(c)}, 0, SEM_WAITLIST_INITIALIZER, SEMHOLDER_INITIALIZER}
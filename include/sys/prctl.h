@@ -69,6 +69,17 @@
  *
  *      char myname[CONFIG_TASK_NAME_SIZE];
  *      prctl(PR_GET_NAME_EXT, myname, pid);
+ *
+ *  PR_SET_TIMERSLACK
+ *    Set the timer slack of the calling thread to (unsigned long) arg2
+ *    nanoseconds.  The timed waits of the thread may then be deferred by up
+ *    to that amount so that nearby timer expirations can be coalesced.
+ *    Requires CONFIG_WDOG_TIMER_SLACK.  As an example:
+ *
+ *      prctl(PR_SET_TIMERSLACK, 2000000);
+ *
+ *  PR_GET_TIMERSLACK
+ *    Return the timer slack of the calling thread in nanoseconds.
  */
 
 #define PR_SET_NAME     1
@@ -79,6 +90,9 @@
 #define PR_SET_DUMPABLE 5
 #define PR_GET_DUMPABLE 6
 
+#define PR_SET_TIMERSLACK 29
+#define PR_GET_TIMERSLACK 30
+
 /****************************************************************************
  * Public Type Definitions
  ****************************************************************************/
@@ -35,6 +35,7 @@
 #include <nuttx/cache.h>
 #include <nuttx/elf.h>
 #include <nuttx/lib/elf.h>
+#include <nuttx/mm/arena.h>
 
 #include "libc.h"
 #include "elf/elf.h"
@@ -47,6 +48,10 @@
 #define I_PLT   1    /* ... for PLTs */
 #define N_RELS  2    /* Number of relxxx[] indexes */
 
+/* Number of symbol cache entries allocated at once */
+
+#define ELF_SYMCACHE_CHUNKCOUNT 16
+
 #ifdef ARCH_ELFDATA
 #  define ARCH_ELFDATA_DEF  arch_elfdata_t arch_data; \
                             memset(&arch_data, 0, sizeof(arch_elfdata_t))
@@ -185,6 +190,7 @@ static int libelf_relocate(FAR struct module_s *modp,
   FAR Elf_Rel      *rels;
   FAR Elf_Rel      *rel;
   FAR Elf_SymCache *cache;
+  FAR struct arena_s *arena;
   FAR Elf_Sym      *sym;
   FAR dq_entry_t   *e;
   dq_queue_t        q;
@@ -198,11 +204,27 @@ static int libelf_relocate(FAR struct module_s *modp,
 
   ARCH_ELFDATA_DEF;
 
-  rels = lib_malloc(CONFIG_LIBC_ELF_RELOCATION_BUFFERCOUNT *
-                    sizeof(Elf_Rel));
+  /* The relocation buffer and the symbol cache only live for the duration
+   * of this call, so carve them all from one arena.  The first chunk holds
+   * the relocation buffer; the cache grows in smaller chunks as symbols
+   * are looked up.
+   */
+
+  arena = arena_create(NULL, CONFIG_LIBC_ELF_RELOCATION_BUFFERCOUNT *
+                             sizeof(Elf_Rel),
+                       ELF_SYMCACHE_CHUNKCOUNT * sizeof(Elf_SymCache));
+  if (arena == NULL)
+    {
+      berr("Failed to allocate memory for elf relocation rels\n");
+      return -ENOMEM;
+    }
+
+  rels = arena_alloc(arena, CONFIG_LIBC_ELF_RELOCATION_BUFFERCOUNT *
+                     sizeof(Elf_Rel));
   if (!rels)
     {
       berr("Failed to allocate memory for elf relocation rels\n");
+      arena_destroy(arena);
       return -ENOMEM;
     }
 
@@ -261,7 +283,7 @@ static int libelf_relocate(FAR struct module_s *modp,
         {
           if (j < CONFIG_LIBC_ELF_SYMBOL_CACHECOUNT)
             {
-              cache = lib_malloc(sizeof(Elf_SymCache));
+              cache = arena_alloc(arena, sizeof(Elf_SymCache));
               if (!cache)
                 {
                   berr("Failed to allocate memory for elf symbols\n");
@@ -287,7 +309,6 @@ static int libelf_relocate(FAR struct module_s *modp,
               berr("ERROR: Section %d reloc %d: "
                    "Failed to read symbol[%d]: %d\n",
                    relidx, i, symidx, ret);
-              lib_free(cache);
               break;
             }
 
@@ -319,7 +340,6 @@ static int libelf_relocate(FAR struct module_s *modp,
                   berr("ERROR: Section %d reloc %d: "
                        "Failed to get value of symbol[%d]: %d\n",
                        relidx, i, symidx, ret);
-                  lib_free(cache);
                   break;
                 }
             }
@@ -416,12 +436,7 @@ static int libelf_relocate(FAR struct module_s *modp,
         }
     }
 
-  lib_free(rels);
-  while ((e = dq_peek(&q)) != NULL)
-    {
-      dq_rem(e, &q);
-      lib_free(e);
-    }
+  arena_destroy(arena);
 
   return ret;
 }
@@ -437,6 +452,7 @@ static int libelf_relocateadd(FAR struct module_s *modp,
   FAR Elf_Rela     *relas;
   FAR Elf_Rela     *rela;
   FAR Elf_SymCache *cache;
+  FAR struct arena_s *arena;
   FAR Elf_Sym      *sym;
   FAR dq_entry_t   *e;
   dq_queue_t        q;
@@ -450,11 +466,27 @@ static int libelf_relocateadd(FAR struct module_s *modp,
 
   ARCH_ELFDATA_DEF;
 
-  relas = lib_malloc(CONFIG_LIBC_ELF_RELOCATION_BUFFERCOUNT *
-                     sizeof(Elf_Rela));
+  /* The relocation buffer and the symbol cache only live for the duration
+   * of this call, so carve them all from one arena.  The first chunk holds
+   * the relocation buffer; the cache grows in smaller chunks as symbols
+   * are looked up.
+   */
+
+  arena = arena_create(NULL, CONFIG_LIBC_ELF_RELOCATION_BUFFERCOUNT *
+                             sizeof(Elf_Rela),
+                       ELF_SYMCACHE_CHUNKCOUNT * sizeof(Elf_SymCache));
+  if (arena == NULL)
+    {
+      berr("Failed to allocate memory for elf relocation relas\n");
+      return -ENOMEM;
+    }
+
+  relas = arena_alloc(arena, CONFIG_LIBC_ELF_RELOCATION_BUFFERCOUNT *
+                      sizeof(Elf_Rela));
   if (!relas)
     {
       berr("Failed to allocate memory for elf relocation relas\n");
+      arena_destroy(arena);
       return -ENOMEM;
     }
 
@@ -513,7 +545,7 @@ static int libelf_relocateadd(FAR struct module_s *modp,
         {
           if (j < CONFIG_LIBC_ELF_SYMBOL_CACHECOUNT)
             {
-              cache = lib_malloc(sizeof(Elf_SymCache));
+              cache = arena_alloc(arena, sizeof(Elf_SymCache));
               if (!cache)
                 {
                   berr("Failed to allocate memory for elf symbols\n");
@@ -539,7 +571,6 @@ static int libelf_relocateadd(FAR struct module_s *modp,
               berr("ERROR: Section %d reloc %d: "
                    "Failed to read symbol[%d]: %d\n",
                    relidx, i, symidx, ret);
-              lib_free(cache);
               break;
             }
 
@@ -571,7 +602,6 @@ static int libelf_relocateadd(FAR struct module_s *modp,
                   berr("ERROR: Section %d reloc %d: "
                        "Failed to get value of symbol[%d]: %d\n",
                        relidx, i, symidx, ret);
-                  lib_free(cache);
                   break;
                 }
             }
@@ -612,12 +642,7 @@ static int libelf_relocateadd(FAR struct module_s *modp,
         }
     }
 
-  lib_free(relas);
-  while ((e = dq_peek(&q)) != NULL)
-    {
-      dq_rem(e, &q);
-      lib_free(e);
-    }
+  arena_destroy(arena);
 
   return ret;
 }
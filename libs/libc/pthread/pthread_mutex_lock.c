@@ -28,6 +28,11 @@
 
 #include <pthread.h>
 
+#include <nuttx/atomic.h>
+#include <nuttx/pthread.h>
+#include <nuttx/sched.h>
+#include <nuttx/semaphore.h>
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -84,6 +89,29 @@
 
 int pthread_mutex_lock(FAR pthread_mutex_t *mutex)
 {
+#ifdef CONFIG_PTHREAD_FASTPATH
+  /* Try to take an uncontended mutex with a single atomic operation in
+   * user memory.  The OS is only entered if we have to wait.
+   */
+
+  if (mutex != NULL && pthread_mutex_fastpath(mutex))
+    {
+      int32_t old = NXSEM_NO_MHOLDER;
+
+      if (atomic_try_cmpxchg_acquire(NXSEM_MHOLDER(PTHREAD_MUTEX_SEM(mutex)),
+                                     &old, _SCHED_GETTID()))
+        {
+#ifdef CONFIG_PTHREAD_MUTEX_TYPES
+          mutex->mutex.count = 1;
+          nxmutex_add_backtrace(&mutex->mutex.mutex);
+#else
+          nxmutex_add_backtrace(&mutex->mutex);
+#endif
+          return OK;
+        }
+    }
+#endif
+
   /* pthread_mutex_lock() is equivalent to pthread_mutex_timedlock() when
    * the absolute time delay is a NULL value.
    */
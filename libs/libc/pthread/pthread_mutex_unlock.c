@@ -0,0 +1,87 @@
+/****************************************************************************
+ * libs/libc/pthread/pthread_mutex_unlock.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <pthread.h>
+#include <errno.h>
+
+#include <nuttx/mutex.h>
+#include <nuttx/pthread.h>
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: pthread_mutex_unlock
+ *
+ * Description:
+ *   The pthread_mutex_unlock() function releases the mutex object referenced
+ *   by mutex. The manner in which a mutex is released is dependent upon the
+ *   mutex's type attribute. If there are threads blocked on the mutex object
+ *   referenced by mutex when pthread_mutex_unlock() is called, resulting in
+ *   the mutex becoming available, the scheduling policy is used to determine
+ *   which thread shall acquire the mutex.
+ *
+ * Input Parameters:
+ *   mutex - A reference to the mutex to be unlocked.
+ *
+ * Returned Value:
+ *   0 on success or an errno value on failure.
+ *
+ ****************************************************************************/
+
+int pthread_mutex_unlock(FAR pthread_mutex_t *mutex)
+{
+#ifdef CONFIG_PTHREAD_FASTPATH
+  if (mutex != NULL && pthread_mutex_fastpath(mutex))
+    {
+      /* No error checking is performed for the non-robust NORMAL mutex,
+       * it only must be locked.  Releasing it is a single atomic operation
+       * on the holder word unless there are waiters to be woken up.
+       */
+
+#ifdef CONFIG_PTHREAD_MUTEX_TYPES
+      if (!nxrmutex_is_locked(&mutex->mutex))
+        {
+          return EPERM;
+        }
+
+      return -nxrmutex_unlock(&mutex->mutex);
+#else
+      if (!nxmutex_is_locked(&mutex->mutex))
+        {
+          return EPERM;
+        }
+
+      return -nxmutex_unlock(&mutex->mutex);
+#endif
+    }
+#endif
+
+  return nx_pthread_mutex_unlock(mutex);
+}
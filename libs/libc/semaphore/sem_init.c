@@ -81,10 +81,9 @@ int nxsem_init(FAR sem_t *sem, int pshared, uint32_t value)
   sem->flags = 0;
 
 #ifdef CONFIG_PRIORITY_INHERITANCE
+  INITIALIZE_SEMHOLDER(&sem->holder);
 #  if CONFIG_SEM_PREALLOCHOLDERS > 0
   sem->hhead = NULL;
-#  else
-  INITIALIZE_SEMHOLDER(&sem->holder);
 #  endif
 #endif
   return OK;
@@ -0,0 +1,212 @@
+/****************************************************************************
+ * mm/arena/arena.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <nuttx/nuttx.h>
+#include <nuttx/lib/lib.h>
+#include <nuttx/mm/arena.h>
+#include <nuttx/mm/mm.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define ARENA_HDRSIZE        ALIGN_UP(sizeof(struct arena_s), MM_ALIGN)
+#define ARENA_CHUNK_HDRSIZE  ALIGN_UP(sizeof(struct arena_chunk_s), MM_ALIGN)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* Header of each chunk allocated after the first one */
+
+struct arena_chunk_s
+{
+  FAR struct arena_chunk_s *next;      /* The previously allocated chunk */
+};
+
+struct arena_s
+{
+  FAR struct mm_heap_s     *heap;      /* Backing heap, NULL for default */
+  size_t                    initsize;  /* The size of the first chunk */
+  size_t                    chunksize; /* The size of each further chunk */
+  FAR struct arena_chunk_s *chunks;    /* Extra chunks, newest first */
+  FAR char                 *next;      /* Next free byte in current chunk */
+  FAR char                 *end;       /* End of the current chunk */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static FAR void *arena_heap_alloc(FAR struct mm_heap_s *heap, size_t size)
+{
+  return heap != NULL ? mm_malloc(heap, size) : lib_malloc(size);
+}
+
+static void arena_heap_free(FAR struct mm_heap_s *heap, FAR void *mem)
+{
+  if (heap != NULL)
+    {
+      mm_free(heap, mem);
+    }
+  else
+    {
+      lib_free(mem);
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: arena_create
+ ****************************************************************************/
+
+FAR struct arena_s *arena_create(FAR struct mm_heap_s *heap,
+                                 size_t initsize, size_t chunksize)
+{
+  FAR struct arena_s *arena;
+
+  initsize = ALIGN_UP(initsize, MM_ALIGN);
+  arena = arena_heap_alloc(heap, ARENA_HDRSIZE + initsize);
+  if (arena == NULL)
+    {
+      return NULL;
+    }
+
+  arena->heap      = heap;
+  arena->initsize  = initsize;
+  arena->chunksize = ALIGN_UP(chunksize, MM_ALIGN);
+  arena->chunks    = NULL;
+  arena->next      = (FAR char *)arena + ARENA_HDRSIZE;
+  arena->end       = arena->next + initsize;
+  return arena;
+}
+
+/****************************************************************************
+ * Name: arena_alloc
+ ****************************************************************************/
+
+FAR void *arena_alloc(FAR struct arena_s *arena, size_t size)
+{
+  FAR struct arena_chunk_s *chunk;
+  FAR void *ret;
+  size_t chunksize;
+
+  DEBUGASSERT(arena != NULL);
+
+  if (size > SIZE_MAX - ARENA_CHUNK_HDRSIZE - MM_ALIGN)
+    {
+      return NULL;
+    }
+
+  size = ALIGN_UP(size > 0 ? size : 1, MM_ALIGN);
+  if (size > (size_t)(arena->end - arena->next))
+    {
+      /* Start a new chunk.  Oversized requests get a chunk of their own,
+       * and the current chunk stays in use in that case.
+       */
+
+      chunksize = size > arena->chunksize ? size : arena->chunksize;
+      chunk = arena_heap_alloc(arena->heap, ARENA_CHUNK_HDRSIZE + chunksize);
+      if (chunk == NULL)
+        {
+          return NULL;
+        }
+
+      chunk->next   = arena->chunks;
+      arena->chunks = chunk;
+
+      ret = (FAR char *)chunk + ARENA_CHUNK_HDRSIZE;
+      if (chunksize > size)
+        {
+          arena->next = (FAR char *)ret + size;
+          arena->end  = (FAR char *)ret + chunksize;
+        }
+
+      return ret;
+    }
+
+  ret = arena->next;
+  arena->next += size;
+  return ret;
+}
+
+/****************************************************************************
+ * Name: arena_zalloc
+ ****************************************************************************/
+
+FAR void *arena_zalloc(FAR struct arena_s *arena, size_t size)
+{
+  FAR void *ret = arena_alloc(arena, size);
+
+  if (ret != NULL)
+    {
+      memset(ret, 0, size);
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: arena_reset
+ ****************************************************************************/
+
+void arena_reset(FAR struct arena_s *arena)
+{
+  FAR struct arena_chunk_s *chunk;
+
+  DEBUGASSERT(arena != NULL);
+
+  while ((chunk = arena->chunks) != NULL)
+    {
+      arena->chunks = chunk->next;
+      arena_heap_free(arena->heap, chunk);
+    }
+
+  arena->next = (FAR char *)arena + ARENA_HDRSIZE;
+  arena->end  = arena->next + arena->initsize;
+}
+
+/****************************************************************************
+ * Name: arena_destroy
+ ****************************************************************************/
+
+void arena_destroy(FAR struct arena_s *arena)
+{
+  if (arena != NULL)
+    {
+      arena_reset(arena);
+      arena_heap_free(arena->heap, arena);
+    }
+}
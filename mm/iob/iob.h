@@ -51,6 +51,35 @@
 #  define iobinfo                _none
 #endif /* CONFIG_DEBUG_FEATURES && CONFIG_IOB_DEBUG */
 
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+#ifdef CONFIG_IOB_PERCPU
+/* A small cache of free I/O buffers private to one CPU.  The lock is only
+ * contended when another CPU drains the cache.
+ */
+
+struct iob_percpu_s
+{
+  spinlock_t        lock;    /* Protects the cache against draining */
+  FAR struct iob_s *head;    /* Free I/O buffers cached by this CPU */
+  int16_t           count;   /* Number of I/O buffers in the cache */
+  unsigned long     nalloc;  /* Allocations served from the cache */
+  unsigned long     nfree;   /* Frees absorbed by the cache */
+};
+#endif
+
+#ifdef CONFIG_IOB_ALLOC
+/* An I/O buffer whose payload is a slice of an external buffer */
+
+struct iob_extiob_s
+{
+  struct iob_s             iob;  /* Must be first */
+  FAR struct iob_extbuf_s *ext;  /* The external buffer referenced */
+};
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -98,6 +127,10 @@ extern int16_t g_qentry_wait;
 
 extern volatile spinlock_t g_iob_lock;
 
+#ifdef CONFIG_IOB_PERCPU
+extern struct iob_percpu_s g_iob_percpu[CONFIG_SMP_NCPUS];
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -161,5 +194,77 @@ FAR struct iob_qentry_s *iob_free_qentry(FAR struct iob_qentry_s *iobq);
 void iob_notifier_signal(void);
 #endif
 
+/****************************************************************************
+ * Name: iob_free_list
+ *
+ * Description:
+ *   Return a NULL terminated list of pool I/O buffers to the free or the
+ *   committed list, taking the lock only once for the whole list.  If
+ *   cache is true, the per-CPU cache of the calling CPU is filled first.
+ *
+ ****************************************************************************/
+
+void iob_free_list(FAR struct iob_s *iob, bool cache);
+
+#ifdef CONFIG_IOB_PERCPU
+/****************************************************************************
+ * Name: iob_percpu_alloc
+ *
+ * Description:
+ *   Take an I/O buffer from the cache of the calling CPU.  Returns NULL if
+ *   the cache is empty.
+ *
+ ****************************************************************************/
+
+FAR struct iob_s *iob_percpu_alloc(void);
+
+/****************************************************************************
+ * Name: iob_percpu_free
+ *
+ * Description:
+ *   Move as many I/O buffers of a NULL terminated list as fit into the
+ *   cache of the calling CPU.  Nothing is cached while a task waits for an
+ *   I/O buffer.  Returns the remainder of the list.
+ *
+ ****************************************************************************/
+
+FAR struct iob_s *iob_percpu_free(FAR struct iob_s *iob);
+
+/****************************************************************************
+ * Name: iob_percpu_drain
+ *
+ * Description:
+ *   Return the I/O buffers cached by all CPUs to the shared pool.  Returns
+ *   the number of I/O buffers returned.
+ *
+ ****************************************************************************/
+
+int iob_percpu_drain(void);
+
+/****************************************************************************
+ * Name: iob_percpu_navail
+ *
+ * Description:
+ *   Return the number of I/O buffers cached by all CPUs.
+ *
+ ****************************************************************************/
+
+int iob_percpu_navail(void);
+#endif
+
+/****************************************************************************
+ * Name: iob_free_extbuf
+ *
+ * Description:
+ *   The io_free callback of I/O buffers allocated by iob_alloc_extbuf().
+ *   iob_free() recognizes it and drops the external buffer reference
+ *   instead of calling it.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_IOB_ALLOC
+void iob_free_extbuf(FAR void *data);
+#endif
+
 #endif /* CONFIG_MM_IOB */
 #endif /* __MM_IOB_IOB_H */
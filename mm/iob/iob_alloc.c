@@ -167,6 +167,19 @@ static FAR struct iob_s *iob_allocwait(bool throttled, unsigned int timeout)
   sem = &g_iob_sem;
 #endif
 
+#ifdef CONFIG_IOB_PERCPU
+  /* Non-throttled allocations may be served from the cache of this CPU */
+
+  if (!throttled)
+    {
+      iob = iob_percpu_alloc();
+      if (iob != NULL)
+        {
+          return iob;
+        }
+    }
+#endif
+
   /* The following must be atomic; interrupt must be disabled so that there
    * is no conflict with interrupt level I/O buffer allocations.  This is
    * not as bad as it sounds because interrupts will be re-enabled while
@@ -193,6 +206,14 @@ static FAR struct iob_s *iob_allocwait(bool throttled, unsigned int timeout)
 
       spin_unlock_irqrestore(&g_iob_lock, flags);
 
+#ifdef CONFIG_IOB_PERCPU
+      /* Now that we are registered as a waiter, return the cached I/O
+       * buffers to the shared pool where they will be committed to us.
+       */
+
+      iob_percpu_drain();
+#endif
+
       if (timeout == UINT_MAX)
         {
           ret = nxsem_wait_uninterruptible(sem);
@@ -300,6 +321,21 @@ FAR struct iob_s *iob_tryalloc(bool throttled)
   FAR struct iob_s *iob;
   irqstate_t flags;
 
+#ifdef CONFIG_IOB_PERCPU
+  /* Non-throttled allocations may be served from the cache of this CPU */
+
+  if (!throttled)
+    {
+      iob = iob_percpu_alloc();
+      if (iob != NULL)
+        {
+          return iob;
+        }
+    }
+
+retry:
+#endif
+
   /* We don't know what context we are called from so we use extreme measures
    * to protect the free list:  We disable interrupts very briefly.
    */
@@ -307,6 +343,18 @@ FAR struct iob_s *iob_tryalloc(bool throttled)
   flags = spin_lock_irqsave(&g_iob_lock);
   iob = iob_tryalloc_internal(throttled);
   spin_unlock_irqrestore(&g_iob_lock, flags);
+
+#ifdef CONFIG_IOB_PERCPU
+  /* The shared pool may only look empty because the free I/O buffers are
+   * held in the caches of other CPUs.
+   */
+
+  if (iob == NULL && iob_percpu_drain() > 0)
+    {
+      goto retry;
+    }
+#endif
+
   return iob;
 }
 
@@ -396,4 +444,63 @@ FAR struct iob_s *iob_alloc_with_data(FAR void *data, uint16_t size,
 
   return iob;
 }
+
+/****************************************************************************
+ * Name: iob_extbuf_init
+ *
+ * Description:
+ *   Prepare an external buffer for sharing with I/O buffers.  The caller
+ *   holds the initial reference and must drop it with iob_extbuf_put()
+ *   once it has wrapped all the I/O buffers it needs.
+ *
+ ****************************************************************************/
+
+void iob_extbuf_init(FAR struct iob_extbuf_s *ext, FAR void *data,
+                     iob_free_cb_t free_cb)
+{
+  DEBUGASSERT(ext != NULL && free_cb != NULL);
+
+  ext->eb_data = data;
+  ext->eb_free = free_cb;
+  atomic_set(&ext->eb_refs, 1);
+}
+
+/****************************************************************************
+ * Name: iob_alloc_extbuf
+ *
+ * Description:
+ *   Allocate an I/O buffer whose payload is a slice of an external buffer.
+ *   The I/O buffer holds a reference to the external buffer until it is
+ *   freed.
+ *
+ ****************************************************************************/
+
+FAR struct iob_s *iob_alloc_extbuf(FAR struct iob_extbuf_s *ext,
+                                   uint16_t offset, uint16_t size)
+{
+  FAR struct iob_extiob_s *extiob;
+  FAR struct iob_s *iob;
+
+  DEBUGASSERT(ext != NULL && atomic_read(&ext->eb_refs) > 0);
+
+  extiob = kmm_malloc(sizeof(struct iob_extiob_s));
+  if (extiob == NULL)
+    {
+      return NULL;
+    }
+
+  atomic_fetch_add(&ext->eb_refs, 1);
+  extiob->ext     = ext;
+
+  iob             = &extiob->iob;
+  iob->io_flink   = NULL;            /* Not in a chain */
+  iob->io_len     = 0;               /* Length of the data in the entry */
+  iob->io_offset  = 0;               /* Offset to the beginning of data */
+  iob->io_bufsize = size;            /* Total length of the iob buffer */
+  iob->io_pktlen  = 0;               /* Total length of the packet */
+  iob->io_free    = iob_free_extbuf; /* Drops the external reference */
+  iob->io_data    = ext->eb_data + offset;
+
+  return iob;
+}
 #endif
@@ -67,6 +67,116 @@
  * Public Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: iob_free_list
+ *
+ * Description:
+ *   Return a NULL terminated list of pool I/O buffers to the free or the
+ *   committed list, taking the lock only once for the whole list.  If
+ *   cache is true, the per-CPU cache of the calling CPU is filled first.
+ *
+ ****************************************************************************/
+
+void iob_free_list(FAR struct iob_s *iob, bool cache)
+{
+  FAR struct iob_s *next;
+  irqstate_t flags;
+  int nwait = 0;
+#if CONFIG_IOB_THROTTLE > 0
+  int nthrottle = 0;
+#endif
+#ifdef CONFIG_IOB_NOTIFIER
+  int16_t navail;
+#endif
+
+#ifdef CONFIG_IOB_PERCPU
+  if (cache)
+    {
+      iob = iob_percpu_free(iob);
+    }
+#endif
+
+  if (iob != NULL)
+    {
+      /* Free the I/O buffers by adding them to the head of the free or the
+       * committed list. We don't know what context we are called from so
+       * we use extreme measures to protect the free list:  We disable
+       * interrupts very briefly.
+       */
+
+      flags = spin_lock_irqsave(&g_iob_lock);
+
+      for (; iob != NULL; iob = next)
+        {
+          next = iob->io_flink;
+
+          /* Which list?  If there is a task waiting for an IOB, then put
+           * the IOB on either the free list or on the committed list where
+           * it is reserved for that allocation (and not available to
+           * iob_tryalloc()). This is true for both throttled and
+           * non-throttled cases.
+           */
+
+          if (g_iob_count < 0)
+            {
+              g_iob_count++;
+              iob->io_flink   = g_iob_committed;
+              g_iob_committed = iob;
+              nwait++;
+            }
+#if CONFIG_IOB_THROTTLE > 0
+          else if (g_throttle_wait > 0 && g_iob_count >= CONFIG_IOB_THROTTLE)
+            {
+              iob->io_flink   = g_iob_committed;
+              g_iob_committed = iob;
+              g_throttle_wait--;
+              nthrottle++;
+            }
+#endif
+          else
+            {
+              g_iob_count++;
+              iob->io_flink   = g_iob_freelist;
+              g_iob_freelist  = iob;
+            }
+
+          DEBUGASSERT(g_iob_count <= CONFIG_IOB_NBUFFERS);
+        }
+
+      spin_unlock_irqrestore(&g_iob_lock, flags);
+
+      /* Wake up the waiters that were handed an I/O buffer */
+
+      while (nwait-- > 0)
+        {
+          nxsem_post(&g_iob_sem);
+        }
+
+#if CONFIG_IOB_THROTTLE > 0
+      while (nthrottle-- > 0)
+        {
+          nxsem_post(&g_throttle_sem);
+        }
+#endif
+    }
+
+#ifdef CONFIG_IOB_NOTIFIER
+  /* Check if the IOB was claimed by a thread that is blocked waiting
+   * for an IOB.
+   */
+
+  navail = iob_navail(false);
+  if (navail > 0 && (navail & IOB_MASK) == 0)
+    {
+      /* Signal any threads that have requested a signal notification
+       * when an IOB becomes available.
+       */
+
+      iob_notifier_signal();
+    }
+#endif
+}
+
 /****************************************************************************
  * Name: iob_free
  *
@@ -79,10 +189,6 @@
 FAR struct iob_s *iob_free(FAR struct iob_s *iob)
 {
   FAR struct iob_s *next = iob->io_flink;
-  irqstate_t flags;
-#ifdef CONFIG_IOB_NOTIFIER
-  int16_t navail;
-#endif
 
   iobinfo("iob=%p io_pktlen=%u io_len=%u next=%p\n",
           iob, iob->io_pktlen, iob->io_len, next);
@@ -118,7 +224,13 @@ FAR struct iob_s *iob_free(FAR struct iob_s *iob)
     }
 
 #ifdef CONFIG_IOB_ALLOC
-  if (iob->io_free != NULL)
+  if (iob->io_free == iob_free_extbuf)
+    {
+      iob_extbuf_put(((FAR struct iob_extiob_s *)iob)->ext);
+      kmm_free(iob);
+      return next;
+    }
+  else if (iob->io_free != NULL)
     {
       iob->io_free(iob->io_data);
       kmm_free(iob);
@@ -126,66 +238,48 @@ FAR struct iob_s *iob_free(FAR struct iob_s *iob)
     }
 #endif
 
-  /* Free the I/O buffer by adding it to the head of the free or the
-   * committed list. We don't know what context we are called from so
-   * we use extreme measures to protect the free list:  We disable
-   * interrupts very briefly.
-   */
+  /* Return the I/O buffer to the pool */
 
-  flags = spin_lock_irqsave(&g_iob_lock);
+  iob->io_flink = NULL;
+  iob_free_list(iob, true);
 
-  /* Which list?  If there is a task waiting for an IOB, then put
-   * the IOB on either the free list or on the committed list where
-   * it is reserved for that allocation (and not available to
-   * iob_tryalloc()). This is true for both throttled and non-throttled
-   * cases.
-   */
+  /* And return the I/O buffer after the one that was freed */
 
-  if (g_iob_count < 0)
-    {
-      g_iob_count++;
-      iob->io_flink   = g_iob_committed;
-      g_iob_committed = iob;
-      spin_unlock_irqrestore(&g_iob_lock, flags);
-      nxsem_post(&g_iob_sem);
-    }
-#if CONFIG_IOB_THROTTLE > 0
-  else if (g_throttle_wait > 0 && g_iob_count >= CONFIG_IOB_THROTTLE)
-    {
-      iob->io_flink   = g_iob_committed;
-      g_iob_committed = iob;
-      g_throttle_wait--;
-      spin_unlock_irqrestore(&g_iob_lock, flags);
-      nxsem_post(&g_throttle_sem);
-    }
-#endif
-  else
-    {
-      g_iob_count++;
-      iob->io_flink   = g_iob_freelist;
-      g_iob_freelist  = iob;
-      spin_unlock_irqrestore(&g_iob_lock, flags);
-    }
+  return next;
+}
 
-  DEBUGASSERT(g_iob_count <= CONFIG_IOB_NBUFFERS);
+#ifdef CONFIG_IOB_ALLOC
+/****************************************************************************
+ * Name: iob_extbuf_put
+ *
+ * Description:
+ *   Drop one reference to an external buffer, returning the buffer to its
+ *   owner if that was the last one.
+ *
+ ****************************************************************************/
 
-#ifdef CONFIG_IOB_NOTIFIER
-  /* Check if the IOB was claimed by a thread that is blocked waiting
-   * for an IOB.
-   */
+void iob_extbuf_put(FAR struct iob_extbuf_s *ext)
+{
+  DEBUGASSERT(ext != NULL && atomic_read(&ext->eb_refs) > 0);
 
-  navail = iob_navail(false);
-  if (navail > 0 && (navail & IOB_MASK) == 0)
+  if (atomic_fetch_sub(&ext->eb_refs, 1) == 1)
     {
-      /* Signal any threads that have requested a signal notification
-       * when an IOB becomes available.
-       */
-
-      iob_notifier_signal();
+      ext->eb_free(ext->eb_data);
     }
-#endif
+}
 
-  /* And return the I/O buffer after the one that was freed */
+/****************************************************************************
+ * Name: iob_free_extbuf
+ *
+ * Description:
+ *   The io_free callback of I/O buffers allocated by iob_alloc_extbuf().
+ *   iob_free() recognizes it and drops the external buffer reference
+ *   instead, so it is never called.
+ *
+ ****************************************************************************/
 
-  return next;
+void iob_free_extbuf(FAR void *data)
+{
+  DEBUGPANIC();
 }
+#endif
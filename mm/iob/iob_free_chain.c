@@ -26,6 +26,8 @@
 
 #include <nuttx/config.h>
 
+#include <stdbool.h>
+
 #include <nuttx/arch.h>
 #include <nuttx/mm/iob.h>
 
@@ -46,12 +48,33 @@
 
 void iob_free_chain(FAR struct iob_s *iob)
 {
+  FAR struct iob_s *pool = NULL;
   FAR struct iob_s *next;
 
-  /* Free each IOB in the chain -- one at a time to keep the count straight */
+  /* Collect the pool I/O buffers of the chain so that they can be returned
+   * with a single lock acquisition.  The packet length kept in the head of
+   * the chain is irrelevant since the whole chain goes away.
+   */
 
   for (; iob; iob = next)
     {
-      next = iob_free(iob);
+      next = iob->io_flink;
+
+#ifdef CONFIG_IOB_ALLOC
+      if (iob->io_free != NULL)
+        {
+          iob->io_flink = NULL;
+          iob_free(iob);
+          continue;
+        }
+#endif
+
+      iob->io_flink = pool;
+      pool          = iob;
+    }
+
+  if (pool != NULL)
+    {
+      iob_free_list(pool, true);
     }
 }
@@ -51,6 +51,12 @@ int iob_navail(bool throttled)
 #if CONFIG_IOB_NBUFFERS > 0
   ret = g_iob_count;
 
+#ifdef CONFIG_IOB_PERCPU
+  /* The I/O buffers cached by each CPU are available too */
+
+  ret += iob_percpu_navail();
+#endif
+
 #if CONFIG_IOB_THROTTLE > 0
   /* Subtract the throttle value is so requested */
 
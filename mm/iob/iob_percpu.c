@@ -0,0 +1,226 @@
+/****************************************************************************
+ * mm/iob/iob_percpu.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <assert.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/arch.h>
+#include <nuttx/mm/iob.h>
+
+#include "iob.h"
+
+#ifdef CONFIG_IOB_PERCPU
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/* The free I/O buffers cached by each CPU.  I/O buffers in these caches
+ * are not accounted in g_iob_count, so the throttle checks made against
+ * the shared pool remain conservative.
+ */
+
+struct iob_percpu_s g_iob_percpu[CONFIG_SMP_NCPUS];
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: iob_percpu_alloc
+ *
+ * Description:
+ *   Take an I/O buffer from the cache of the calling CPU.  Returns NULL if
+ *   the cache is empty.
+ *
+ ****************************************************************************/
+
+FAR struct iob_s *iob_percpu_alloc(void)
+{
+  FAR struct iob_percpu_s *pcpu;
+  FAR struct iob_s *iob;
+  irqstate_t flags;
+
+  flags = up_irq_save();
+  pcpu  = &g_iob_percpu[this_cpu()];
+
+  spin_lock(&pcpu->lock);
+  iob = pcpu->head;
+  if (iob != NULL)
+    {
+      pcpu->head = iob->io_flink;
+      pcpu->count--;
+      pcpu->nalloc++;
+    }
+
+  spin_unlock(&pcpu->lock);
+  up_irq_restore(flags);
+
+  if (iob != NULL)
+    {
+      /* Put the I/O buffer in a known state */
+
+      iob->io_flink  = NULL; /* Not in a chain */
+      iob->io_len    = 0;    /* Length of the data in the entry */
+      iob->io_offset = 0;    /* Offset to the beginning of data */
+      iob->io_pktlen = 0;    /* Total length of the packet */
+    }
+
+  return iob;
+}
+
+/****************************************************************************
+ * Name: iob_percpu_free
+ *
+ * Description:
+ *   Move as many I/O buffers of a NULL terminated list as fit into the
+ *   cache of the calling CPU.  Nothing is cached while a task waits for an
+ *   I/O buffer.  Returns the remainder of the list.
+ *
+ ****************************************************************************/
+
+FAR struct iob_s *iob_percpu_free(FAR struct iob_s *iob)
+{
+  FAR struct iob_percpu_s *pcpu;
+  FAR struct iob_s *next;
+  irqstate_t flags;
+
+  flags = up_irq_save();
+  pcpu  = &g_iob_percpu[this_cpu()];
+
+  spin_lock(&pcpu->lock);
+
+  /* A waiter registers itself in g_iob_count or g_throttle_wait before it
+   * drains the caches, so checking here under the cache lock guarantees
+   * that no I/O buffer is stranded in a cache while somebody sleeps.
+   */
+
+#if CONFIG_IOB_THROTTLE > 0
+  if (g_iob_count >= 0 && g_throttle_wait == 0)
+#else
+  if (g_iob_count >= 0)
+#endif
+    {
+      while (iob != NULL && pcpu->count < CONFIG_IOB_PERCPU_DEPTH)
+        {
+          next          = iob->io_flink;
+          iob->io_flink = pcpu->head;
+          pcpu->head    = iob;
+          pcpu->count++;
+          pcpu->nfree++;
+          iob           = next;
+        }
+    }
+
+  spin_unlock(&pcpu->lock);
+  up_irq_restore(flags);
+  return iob;
+}
+
+/****************************************************************************
+ * Name: iob_percpu_drain
+ *
+ * Description:
+ *   Return the I/O buffers cached by all CPUs to the shared pool.  Returns
+ *   the number of I/O buffers returned.
+ *
+ ****************************************************************************/
+
+int iob_percpu_drain(void)
+{
+  FAR struct iob_percpu_s *pcpu;
+  FAR struct iob_s *iob;
+  irqstate_t flags;
+  int ndrained = 0;
+  int cpu;
+
+  for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      pcpu  = &g_iob_percpu[cpu];
+
+      flags = spin_lock_irqsave(&pcpu->lock);
+      iob   = pcpu->head;
+      ndrained   += pcpu->count;
+      pcpu->head  = NULL;
+      pcpu->count = 0;
+      spin_unlock_irqrestore(&pcpu->lock, flags);
+
+      if (iob != NULL)
+        {
+          iob_free_list(iob, false);
+        }
+    }
+
+  return ndrained;
+}
+
+/****************************************************************************
+ * Name: iob_percpu_navail
+ *
+ * Description:
+ *   Return the number of I/O buffers cached by all CPUs.
+ *
+ ****************************************************************************/
+
+int iob_percpu_navail(void)
+{
+  int navail = 0;
+  int cpu;
+
+  for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      navail += g_iob_percpu[cpu].count;
+    }
+
+  return navail;
+}
+
+/****************************************************************************
+ * Name: iob_getcpustats
+ *
+ * Description:
+ *   Return the cache statistics of one CPU.
+ *
+ ****************************************************************************/
+
+void iob_getcpustats(int cpu, FAR struct iob_cpustats_s *stats)
+{
+  FAR struct iob_percpu_s *pcpu;
+  irqstate_t flags;
+
+  DEBUGASSERT(cpu >= 0 && cpu < CONFIG_SMP_NCPUS && stats != NULL);
+
+  pcpu           = &g_iob_percpu[cpu];
+  flags          = spin_lock_irqsave(&pcpu->lock);
+  stats->ncached = pcpu->count;
+  stats->nalloc  = pcpu->nalloc;
+  stats->nfree   = pcpu->nfree;
+  spin_unlock_irqrestore(&pcpu->lock, flags);
+}
+
+#endif /* CONFIG_IOB_PERCPU */
@@ -67,6 +67,12 @@ void iob_getstats(FAR struct iob_stats_s *stats)
       stats->nwait = 0;
     }
 
+#ifdef CONFIG_IOB_PERCPU
+  /* Count the I/O buffers cached by each CPU as free */
+
+  stats->nfree += iob_percpu_navail();
+#endif
+
 #if CONFIG_IOB_THROTTLE > 0
   stats->nthrottle = (g_iob_count - CONFIG_IOB_THROTTLE);
   if (stats->nthrottle < 0)
@@ -26,8 +26,12 @@
 
 #include <nuttx/config.h>
 
+#include <stdint.h>
+
 #include <nuttx/mm/mm.h>
 
+#include "kmm_heap/kmm_huge.h"
+
 #ifdef CONFIG_MM_KERNEL_HEAP
 
 /****************************************************************************
@@ -44,6 +48,14 @@
 
 FAR void *kmm_calloc(size_t n, size_t elem_size)
 {
+#ifdef HAVE_KMM_HUGE
+  if (elem_size != 0 && n <= SIZE_MAX / elem_size &&
+      kmm_huge_size_p(n * elem_size))
+    {
+      return kmm_zalloc(n * elem_size);
+    }
+#endif
+
   return mm_calloc(g_kmmheap, n, elem_size);
 }
 
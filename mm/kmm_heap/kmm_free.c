@@ -31,6 +31,8 @@
 
 #include <nuttx/mm/mm.h>
 
+#include "kmm_heap/kmm_huge.h"
+
 #ifdef CONFIG_MM_KERNEL_HEAP
 
 /****************************************************************************
@@ -55,6 +57,15 @@
 void kmm_free(FAR void *mem)
 {
   DEBUGASSERT((mem == NULL) || kmm_heapmember(mem));
+
+#ifdef HAVE_KMM_HUGE
+  if (kmm_huge_member(mem))
+    {
+      kmm_huge_free(mem);
+      return;
+    }
+#endif
+
   mm_free(g_kmmheap, mem);
 }
 
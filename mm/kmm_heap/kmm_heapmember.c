@@ -30,6 +30,8 @@
 
 #include <nuttx/mm/mm.h>
 
+#include "kmm_heap/kmm_huge.h"
+
 #ifdef CONFIG_MM_KERNEL_HEAP
 
 /****************************************************************************
@@ -54,6 +56,13 @@
 
 bool kmm_heapmember(FAR void *mem)
 {
+#ifdef HAVE_KMM_HUGE
+  if (kmm_huge_member(mem))
+    {
+      return true;
+    }
+#endif
+
   return mm_heapmember(g_kmmheap, mem);
 }
 
@@ -0,0 +1,149 @@
+/****************************************************************************
+ * mm/kmm_heap/kmm_huge.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <nuttx/arch.h>
+#include <nuttx/atomic.h>
+#include <nuttx/nuttx.h>
+#include <nuttx/mm/mm.h>
+#include <nuttx/pgalloc.h>
+
+#include "kmm_heap/kmm_huge.h"
+
+#ifdef HAVE_KMM_HUGE
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define KMM_HUGE_HDRSIZE   ALIGN_UP(sizeof(struct kmm_huge_s), MM_ALIGN)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This header precedes every huge allocation.  It records the physical
+ * address and the number of pages so that free and malloc_size are O(1).
+ */
+
+struct kmm_huge_s
+{
+  uintptr_t paddr;
+  size_t    npages;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* Pages currently handed out by kmm_huge_alloc(), for kmm_mallinfo() */
+
+static atomic_t g_kmm_huge_npages;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static inline FAR struct kmm_huge_s *kmm_huge_header(FAR void *mem)
+{
+  return (FAR struct kmm_huge_s *)((FAR char *)mem - KMM_HUGE_HDRSIZE);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: kmm_huge_alloc
+ ****************************************************************************/
+
+FAR void *kmm_huge_alloc(size_t size)
+{
+  FAR struct kmm_huge_s *huge;
+  uintptr_t paddr;
+  size_t npages;
+
+  if (size > SIZE_MAX - KMM_HUGE_HDRSIZE - MM_PGSIZE)
+    {
+      return NULL;
+    }
+
+  npages = MM_NPAGES(size + KMM_HUGE_HDRSIZE);
+  paddr  = mm_pgalloc(npages);
+  if (paddr == 0)
+    {
+      return NULL;
+    }
+
+  huge = (FAR struct kmm_huge_s *)up_addrenv_page_vaddr(paddr);
+  huge->paddr  = paddr;
+  huge->npages = npages;
+  atomic_fetch_add(&g_kmm_huge_npages, npages);
+
+  return (FAR char *)huge + KMM_HUGE_HDRSIZE;
+}
+
+/****************************************************************************
+ * Name: kmm_huge_free
+ ****************************************************************************/
+
+void kmm_huge_free(FAR void *mem)
+{
+  FAR struct kmm_huge_s *huge = kmm_huge_header(mem);
+
+  DEBUGASSERT(kmm_huge_member(mem));
+  atomic_fetch_sub(&g_kmm_huge_npages, huge->npages);
+  mm_pgfree(huge->paddr, huge->npages);
+}
+
+/****************************************************************************
+ * Name: kmm_huge_malloc_size
+ ****************************************************************************/
+
+size_t kmm_huge_malloc_size(FAR void *mem)
+{
+  FAR struct kmm_huge_s *huge = kmm_huge_header(mem);
+
+  return (huge->npages << MM_PGSHIFT) - KMM_HUGE_HDRSIZE;
+}
+
+/****************************************************************************
+ * Name: kmm_huge_mallinfo
+ ****************************************************************************/
+
+void kmm_huge_mallinfo(FAR struct mallinfo *info)
+{
+  size_t bytes = (size_t)atomic_read(&g_kmm_huge_npages) << MM_PGSHIFT;
+
+  info->arena    += bytes;
+  info->uordblks += bytes;
+}
+
+#endif /* HAVE_KMM_HUGE */
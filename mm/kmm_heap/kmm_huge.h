@@ -0,0 +1,124 @@
+/****************************************************************************
+ * mm/kmm_heap/kmm_huge.h
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __MM_KMM_HEAP_KMM_HUGE_H
+#define __MM_KMM_HEAP_KMM_HUGE_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <malloc.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Kernel heap requests of at least CONFIG_MM_KERNEL_HEAP_HUGE_THRESHOLD
+ * bytes are served directly from the page allocator.  This relies on the
+ * linear page pool mapping so that a run of physical pages is also
+ * contiguous in the kernel virtual address space.
+ */
+
+#if defined(CONFIG_MM_KERNEL_HEAP_HUGE_THRESHOLD) && \
+    CONFIG_MM_KERNEL_HEAP_HUGE_THRESHOLD > 0
+#  define HAVE_KMM_HUGE 1
+#endif
+
+#ifdef HAVE_KMM_HUGE
+
+/* Return true if the request should bypass the kernel heap */
+
+#define kmm_huge_size_p(size) ((size) >= CONFIG_MM_KERNEL_HEAP_HUGE_THRESHOLD)
+
+/****************************************************************************
+ * Inline Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: kmm_huge_member
+ *
+ * Description:
+ *   Return true if the memory was allocated by kmm_huge_alloc().  This is a
+ *   simple address range check against the page pool mapping.
+ *
+ ****************************************************************************/
+
+static inline bool kmm_huge_member(FAR void *mem)
+{
+  return (uintptr_t)mem >= CONFIG_ARCH_PGPOOL_VBASE &&
+         (uintptr_t)mem < CONFIG_ARCH_PGPOOL_VBASE + CONFIG_ARCH_PGPOOL_SIZE;
+}
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: kmm_huge_alloc
+ *
+ * Description:
+ *   Allocate memory directly from the page allocator.  Returns NULL if the
+ *   page pool cannot satisfy the request; the caller should then fall back
+ *   to the kernel heap.
+ *
+ ****************************************************************************/
+
+FAR void *kmm_huge_alloc(size_t size);
+
+/****************************************************************************
+ * Name: kmm_huge_free
+ *
+ * Description:
+ *   Return the pages of an allocation made by kmm_huge_alloc().
+ *
+ ****************************************************************************/
+
+void kmm_huge_free(FAR void *mem);
+
+/****************************************************************************
+ * Name: kmm_huge_malloc_size
+ *
+ * Description:
+ *   Return the usable size of an allocation made by kmm_huge_alloc().
+ *
+ ****************************************************************************/
+
+size_t kmm_huge_malloc_size(FAR void *mem);
+
+/****************************************************************************
+ * Name: kmm_huge_mallinfo
+ *
+ * Description:
+ *   Add the pages held by huge allocations to the kernel heap statistics,
+ *   so that they are reported as in use rather than silently missing.
+ *
+ ****************************************************************************/
+
+void kmm_huge_mallinfo(FAR struct mallinfo *info);
+
+#endif /* HAVE_KMM_HUGE */
+#endif /* __MM_KMM_HEAP_KMM_HUGE_H */
@@ -28,6 +28,8 @@
 
 #include <nuttx/mm/mm.h>
 
+#include "kmm_heap/kmm_huge.h"
+
 #ifdef CONFIG_MM_KERNEL_HEAP
 
 /****************************************************************************
@@ -45,7 +47,14 @@
 
 struct mallinfo kmm_mallinfo(void)
 {
+#ifdef HAVE_KMM_HUGE
+  struct mallinfo info = mm_mallinfo(g_kmmheap);
+
+  kmm_huge_mallinfo(&info);
+  return info;
+#else
   return mm_mallinfo(g_kmmheap);
+#endif
 }
 
 /****************************************************************************
@@ -28,6 +28,8 @@
 
 #include <nuttx/mm/mm.h>
 
+#include "kmm_heap/kmm_huge.h"
+
 #ifdef CONFIG_MM_KERNEL_HEAP
 
 /****************************************************************************
@@ -50,7 +52,40 @@
 
 FAR void *kmm_malloc(size_t size)
 {
+#ifdef HAVE_KMM_HUGE
+  if (kmm_huge_size_p(size))
+    {
+      FAR void *mem = kmm_huge_alloc(size);
+      if (mem != NULL)
+        {
+          return mem;
+        }
+    }
+#endif
+
   return mm_malloc(g_kmmheap, size);
 }
 
+#ifdef CONFIG_MM_HEAP_LIFETIME
+/****************************************************************************
+ * Name: kmm_malloc_longlived
+ *
+ * Description:
+ *   Allocate memory from the kernel heap that is expected to be kept for a
+ *   long time, such as driver state allocated at initialization.
+ *
+ * Input Parameters:
+ *   size - Size (in bytes) of the memory region to be allocated.
+ *
+ * Returned Value:
+ *   The address of the allocated memory (NULL on failure to allocate)
+ *
+ ****************************************************************************/
+
+FAR void *kmm_malloc_longlived(size_t size)
+{
+  return mm_malloc_longlived(g_kmmheap, size);
+}
+#endif
+
 #endif /* CONFIG_MM_KERNEL_HEAP */
@@ -28,6 +28,8 @@
 
 #include <nuttx/mm/mm.h>
 
+#include "kmm_heap/kmm_huge.h"
+
 #ifdef CONFIG_MM_KERNEL_HEAP
 
 /****************************************************************************
@@ -36,6 +38,13 @@
 
 size_t kmm_malloc_size(FAR void *mem)
 {
+#ifdef HAVE_KMM_HUGE
+  if (kmm_huge_member(mem))
+    {
+      return kmm_huge_malloc_size(mem);
+    }
+#endif
+
   return mm_malloc_size(g_kmmheap, mem);
 }
 
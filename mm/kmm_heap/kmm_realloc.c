@@ -26,8 +26,13 @@
 
 #include <nuttx/config.h>
 
+#include <string.h>
+#include <sys/param.h>
+
 #include <nuttx/mm/mm.h>
 
+#include "kmm_heap/kmm_huge.h"
+
 #ifdef CONFIG_MM_KERNEL_HEAP
 
 /****************************************************************************
@@ -51,7 +56,50 @@
 
 FAR void *kmm_realloc(FAR void *oldmem, size_t newsize)
 {
+#ifdef HAVE_KMM_HUGE
+  FAR void *newmem;
+
+  if (oldmem == NULL)
+    {
+      return kmm_malloc(newsize);
+    }
+
+  /* Huge allocations live outside of the heap, so moving into or out of
+   * the page pool always takes a copy.
+   */
+
+  if (kmm_huge_member(oldmem))
+    {
+      /* As with realloc(ptr, 0), a zero size just frees the pages */
+
+      if (newsize == 0)
+        {
+          kmm_huge_free(oldmem);
+          return NULL;
+        }
+
+      if (kmm_huge_size_p(newsize) &&
+          newsize <= kmm_huge_malloc_size(oldmem))
+        {
+          return oldmem;
+        }
+    }
+  else if (!kmm_huge_size_p(newsize))
+    {
+      return mm_realloc(g_kmmheap, oldmem, newsize);
+    }
+
+  newmem = kmm_malloc(newsize);
+  if (newmem != NULL)
+    {
+      memcpy(newmem, oldmem, MIN(newsize, kmm_malloc_size(oldmem)));
+      kmm_free(oldmem);
+    }
+
+  return newmem;
+#else
   return mm_realloc(g_kmmheap, oldmem, newsize);
+#endif
 }
 
 #endif /* CONFIG_MM_KERNEL_HEAP */
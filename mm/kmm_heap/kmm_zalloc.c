@@ -26,8 +26,12 @@
 
 #include <nuttx/config.h>
 
+#include <string.h>
+
 #include <nuttx/mm/mm.h>
 
+#include "kmm_heap/kmm_huge.h"
+
 #ifdef CONFIG_MM_KERNEL_HEAP
 
 /****************************************************************************
@@ -50,7 +54,41 @@
 
 FAR void *kmm_zalloc(size_t size)
 {
+#ifdef HAVE_KMM_HUGE
+  if (kmm_huge_size_p(size))
+    {
+      FAR void *mem = kmm_huge_alloc(size);
+      if (mem != NULL)
+        {
+          memset(mem, 0, size);
+          return mem;
+        }
+    }
+#endif
+
   return mm_zalloc(g_kmmheap, size);
 }
 
+#ifdef CONFIG_MM_HEAP_LIFETIME
+/****************************************************************************
+ * Name: kmm_zalloc_longlived
+ *
+ * Description:
+ *   Allocate and zero memory from the kernel heap that is expected to be
+ *   kept for a long time.
+ *
+ * Input Parameters:
+ *   size - Size (in bytes) of the memory region to be allocated.
+ *
+ * Returned Value:
+ *   The address of the allocated memory (NULL on failure to allocate)
+ *
+ ****************************************************************************/
+
+FAR void *kmm_zalloc_longlived(size_t size)
+{
+  return mm_zalloc_longlived(g_kmmheap, size);
+}
+#endif
+
 #endif /* CONFIG_MM_KERNEL_HEAP */
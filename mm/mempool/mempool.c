@@ -42,6 +42,17 @@
 
 #define MEMPOOL_HEADER_SIZE (sizeof(sq_entry_t) + CONFIG_MM_NODE_GUARDSIZE)
 
+/* The per-CPU free lists are accessed with local interrupts disabled,
+ * which is only possible from the kernel.
+ */
+
+#if defined(CONFIG_MM_MEMPOOL_PERCPU) && \
+    (defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__))
+#  define MEMPOOL_HAVE_PERCPU
+#  define MEMPOOL_PERCPU_DEPTH CONFIG_MM_MEMPOOL_PERCPU_DEPTH
+#  define MEMPOOL_PERCPU_BATCH ((MEMPOOL_PERCPU_DEPTH + 1) / 2)
+#endif
+
 #if CONFIG_MM_BACKTRACE >= 0
 #define MEMPOOL_MAGIC_FREE  0x55555555
 #define MEMPOOL_MAGIC_ALLOC 0xAAAAAAAA
@@ -233,6 +244,184 @@ mempool_memdump_free_callback(FAR struct mempool_s *pool,
 }
 #endif
 
+#ifdef MEMPOOL_HAVE_PERCPU
+/****************************************************************************
+ * Name: mempool_percpu_enabled
+ *
+ * Description:
+ *   Only pools that can expand use the per-CPU free lists.  A pool of
+ *   fixed size must see all of its free blocks on the shared list, or one
+ *   CPU could fail or wait while another one caches the free blocks.
+ *
+ ****************************************************************************/
+
+static inline bool mempool_percpu_enabled(FAR struct mempool_s *pool)
+{
+  return pool->expandsize >= MEMPOOL_REALBLOCKSIZE(pool) +
+                             MEMPOOL_HEADER_SIZE;
+}
+
+/****************************************************************************
+ * Name: mempool_percpu_allocate
+ *
+ * Description:
+ *   Take a block from the free list of the current CPU.  An empty list is
+ *   refilled from the shared free list in one batch.
+ *
+ * Input Parameters:
+ *   pool - Address of the memory pool to be used.
+ *
+ * Returned Value:
+ *   The pointer to the block; NULL if the shared free list is empty too.
+ *
+ ****************************************************************************/
+
+static FAR sq_entry_t *mempool_percpu_allocate(FAR struct mempool_s *pool)
+{
+  FAR struct mempool_percpu_s *percpu;
+  FAR sq_entry_t *blk;
+  irqstate_t flags;
+
+  flags  = up_irq_save();
+  percpu = &pool->percpu[this_cpu()];
+  spin_lock(&percpu->lock);
+
+  if (percpu->nfree == 0)
+    {
+      spin_lock(&pool->lock);
+      while (percpu->nfree < MEMPOOL_PERCPU_BATCH &&
+             (blk = mempool_remove_queue(pool, &pool->queue)) != NULL)
+        {
+          sq_addfirst(blk, &percpu->queue);
+          percpu->nfree++;
+          pool->nalloc++;
+        }
+
+      spin_unlock(&pool->lock);
+    }
+
+  blk = sq_remfirst(&percpu->queue);
+  if (blk != NULL)
+    {
+      blk->flink = NULL;
+      percpu->nfree--;
+    }
+
+  spin_unlock(&percpu->lock);
+  up_irq_restore(flags);
+  return blk;
+}
+
+/****************************************************************************
+ * Name: mempool_percpu_release
+ *
+ * Description:
+ *   Put a block on the free list of the current CPU.  When the list
+ *   overflows, a batch of blocks is spilled back to the shared free list.
+ *
+ * Input Parameters:
+ *   pool - Address of the memory pool to be used.
+ *   blk  - The pointer of memory block.
+ *
+ ****************************************************************************/
+
+static void mempool_percpu_release(FAR struct mempool_s *pool,
+                                   FAR sq_entry_t *blk)
+{
+  FAR struct mempool_percpu_s *percpu;
+  irqstate_t flags;
+
+  flags  = up_irq_save();
+  percpu = &pool->percpu[this_cpu()];
+  spin_lock(&percpu->lock);
+
+  sq_addfirst(blk, &percpu->queue);
+  if (++percpu->nfree > MEMPOOL_PERCPU_DEPTH)
+    {
+      spin_lock(&pool->lock);
+      while (percpu->nfree > MEMPOOL_PERCPU_DEPTH - MEMPOOL_PERCPU_BATCH)
+        {
+          sq_addlast(sq_remfirst(&percpu->queue), &pool->queue);
+          percpu->nfree--;
+          pool->nalloc--;
+        }
+
+      spin_unlock(&pool->lock);
+    }
+
+  spin_unlock(&percpu->lock);
+  up_irq_restore(flags);
+}
+
+/****************************************************************************
+ * Name: mempool_percpu_drain
+ *
+ * Description:
+ *   Move the blocks cached by all CPUs back to the shared free list.  This
+ *   is done before the pool expands, so that blocks freed on one CPU are
+ *   not stranded there while another CPU runs out.
+ *
+ * Returned Value:
+ *   The number of blocks moved to the shared free list.
+ *
+ ****************************************************************************/
+
+static size_t mempool_percpu_drain(FAR struct mempool_s *pool)
+{
+  size_t count = 0;
+  int cpu;
+
+  for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      FAR struct mempool_percpu_s *percpu = &pool->percpu[cpu];
+      FAR sq_entry_t *blk;
+      irqstate_t flags;
+
+      if (percpu->nfree == 0)
+        {
+          continue;
+        }
+
+      flags = spin_lock_irqsave(&percpu->lock);
+      spin_lock(&pool->lock);
+      while ((blk = sq_remfirst(&percpu->queue)) != NULL)
+        {
+          sq_addlast(blk, &pool->queue);
+          pool->nalloc--;
+          count++;
+        }
+
+      percpu->nfree = 0;
+      spin_unlock(&pool->lock);
+      spin_unlock_irqrestore(&percpu->lock, flags);
+    }
+
+  return count;
+}
+
+/****************************************************************************
+ * Name: mempool_percpu_count
+ *
+ * Description:
+ *   Return the number of blocks held by the free lists of all CPUs.  The
+ *   result is only a snapshot since other CPUs may update their lists.
+ *
+ ****************************************************************************/
+
+static size_t mempool_percpu_count(FAR struct mempool_s *pool)
+{
+  size_t count = 0;
+  int cpu;
+
+  for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      count += pool->percpu[cpu].nfree;
+    }
+
+  return count;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -257,9 +446,19 @@ mempool_memdump_free_callback(FAR struct mempool_s *pool,
 int mempool_init(FAR struct mempool_s *pool, FAR const char *name)
 {
   size_t blocksize = MEMPOOL_REALBLOCKSIZE(pool);
+#ifdef MEMPOOL_HAVE_PERCPU
+  int cpu;
+#endif
 
   sq_init(&pool->queue);
   sq_init(&pool->iqueue);
+#ifdef MEMPOOL_HAVE_PERCPU
+  memset(pool->percpu, 0, sizeof(pool->percpu));
+  for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      spin_lock_init(&pool->percpu[cpu].lock);
+    }
+#endif
   sq_init(&pool->equeue);
   pool->nalloc = 0;
   if (pool->interruptsize >= blocksize)
@@ -347,11 +546,39 @@ FAR void *mempool_allocate(FAR struct mempool_s *pool)
   FAR sq_entry_t *blk;
   irqstate_t flags;
 
+#ifdef MEMPOOL_HAVE_PERCPU
+  if (mempool_percpu_enabled(pool))
+    {
+      blk = mempool_percpu_allocate(pool);
+      if (blk != NULL)
+        {
+          goto out;
+        }
+    }
+#endif
+
 retry:
   flags = spin_lock_irqsave(&pool->lock);
   blk = mempool_remove_queue(pool, &pool->queue);
   if (blk == NULL)
     {
+#ifdef MEMPOOL_HAVE_PERCPU
+      /* Take back the blocks cached by other CPUs before touching the
+       * interrupt reserve or expanding the pool.
+       */
+
+      if (mempool_percpu_enabled(pool))
+        {
+          spin_unlock_irqrestore(&pool->lock, flags);
+          if (mempool_percpu_drain(pool) > 0)
+            {
+              goto retry;
+            }
+
+          flags = spin_lock_irqsave(&pool->lock);
+        }
+
+#endif
       if (up_interrupt_context())
         {
           blk = mempool_remove_queue(pool, &pool->iqueue);
@@ -401,6 +628,9 @@ retry:
   pool->nalloc++;
   spin_unlock_irqrestore(&pool->lock, flags);
 
+#ifdef MEMPOOL_HAVE_PERCPU
+out:
+#endif
 #if CONFIG_MM_BACKTRACE >= 0
   mempool_add_backtrace(pool, (FAR struct mempool_backtrace_s *)
                               ((FAR char *)blk + pool->blocksize));
@@ -427,11 +657,40 @@ retry:
 
 void mempool_release(FAR struct mempool_s *pool, FAR void *blk)
 {
-  irqstate_t flags = spin_lock_irqsave(&pool->lock);
   size_t blocksize = MEMPOOL_REALBLOCKSIZE(pool);
+  irqstate_t flags;
 #if CONFIG_MM_BACKTRACE >= 0
   FAR struct mempool_backtrace_s *buf =
     (FAR struct mempool_backtrace_s *)((FAR char *)blk + pool->blocksize);
+#endif
+
+#ifdef MEMPOOL_HAVE_PERCPU
+  /* Blocks of the interrupt reserve and pools of fixed size must go back
+   * to the shared free list.
+   */
+
+  if (mempool_percpu_enabled(pool) &&
+      (pool->interruptsize <= blocksize ||
+       (FAR char *)blk < pool->ibase ||
+       (FAR char *)blk >= pool->ibase + pool->interruptsize - blocksize))
+    {
+#  if CONFIG_MM_BACKTRACE >= 0
+      DEBUGASSERT(buf->magic == MEMPOOL_MAGIC_ALLOC);
+      buf->magic = MEMPOOL_MAGIC_FREE;
+#  endif
+
+#  ifdef CONFIG_MM_FILL_ALLOCATIONS
+      memset(blk, MM_FREE_MAGIC, pool->blocksize);
+#  endif
+
+      kasan_poison(blk, pool->blocksize);
+      mempool_percpu_release(pool, blk);
+      return;
+    }
+#endif
+
+  flags = spin_lock_irqsave(&pool->lock);
+#if CONFIG_MM_BACKTRACE >= 0
 
   /* Check double free or out of out of bounds */
 
@@ -477,6 +736,117 @@ void mempool_release(FAR struct mempool_s *pool, FAR void *blk)
     }
 }
 
+/****************************************************************************
+ * Name: mempool_allocate_batch
+ *
+ * Description:
+ *   Allocate up to nblks blocks from a specific memory pool, taking the
+ *   pool lock only once.  Blocks are only taken from the free queue; the
+ *   pool is never expanded and the caller never blocks.
+ *
+ * Input Parameters:
+ *   pool  - Address of the memory pool to be used.
+ *   blks  - The array that receives the allocated blocks.
+ *   nblks - The maximum number of blocks to allocate.
+ *
+ * Returned Value:
+ *   The number of blocks stored in blks; zero if the queue is empty.
+ *
+ ****************************************************************************/
+
+size_t mempool_allocate_batch(FAR struct mempool_s *pool,
+                              FAR void **blks, size_t nblks)
+{
+  FAR sq_entry_t *blk;
+  irqstate_t flags;
+  size_t n = 0;
+  size_t i;
+
+  flags = spin_lock_irqsave(&pool->lock);
+  while (n < nblks &&
+         (blk = mempool_remove_queue(pool, &pool->queue)) != NULL)
+    {
+      blks[n++] = blk;
+    }
+
+  pool->nalloc += n;
+  spin_unlock_irqrestore(&pool->lock, flags);
+
+  for (i = 0; i < n; i++)
+    {
+#if CONFIG_MM_BACKTRACE >= 0
+      mempool_add_backtrace(pool, (FAR struct mempool_backtrace_s *)
+                                  ((FAR char *)blks[i] + pool->blocksize));
+#endif
+
+      blks[i] = kasan_unpoison(blks[i], pool->blocksize);
+#ifdef CONFIG_MM_FILL_ALLOCATIONS
+      memset(blks[i], MM_ALLOC_MAGIC, pool->blocksize);
+#endif
+    }
+
+  return n;
+}
+
+/****************************************************************************
+ * Name: mempool_release_batch
+ *
+ * Description:
+ *   Release nblks memory blocks to the pool, taking the pool lock only
+ *   once.
+ *
+ * Input Parameters:
+ *   pool  - Address of the memory pool to be used.
+ *   blks  - The array of memory blocks.
+ *   nblks - The number of blocks in blks.
+ *
+ ****************************************************************************/
+
+void mempool_release_batch(FAR struct mempool_s *pool,
+                           FAR void * const *blks, size_t nblks)
+{
+  size_t i;
+
+  if (pool->interruptsize > MEMPOOL_REALBLOCKSIZE(pool) ||
+      (pool->wait && pool->expandsize == 0))
+    {
+      /* Interrupt reserves and waiters need the per block handling */
+
+      for (i = 0; i < nblks; i++)
+        {
+          mempool_release(pool, blks[i]);
+        }
+    }
+  else
+    {
+      irqstate_t flags = spin_lock_irqsave(&pool->lock);
+
+      for (i = 0; i < nblks; i++)
+        {
+#if CONFIG_MM_BACKTRACE >= 0
+          FAR struct mempool_backtrace_s *buf =
+            (FAR struct mempool_backtrace_s *)
+            ((FAR char *)blks[i] + pool->blocksize);
+
+          /* Check double free or out of out of bounds */
+
+          DEBUGASSERT(buf->magic == MEMPOOL_MAGIC_ALLOC);
+          buf->magic = MEMPOOL_MAGIC_FREE;
+#endif
+
+#ifdef CONFIG_MM_FILL_ALLOCATIONS
+          memset(blks[i], MM_FREE_MAGIC, pool->blocksize);
+#endif
+
+          sq_addlast(blks[i], &pool->queue);
+          kasan_poison(blks[i], pool->blocksize);
+        }
+
+      pool->nalloc -= nblks;
+      spin_unlock_irqrestore(&pool->lock, flags);
+    }
+}
+
 /****************************************************************************
  * Name: mempool_info
  *
@@ -495,6 +865,9 @@ int mempool_info(FAR struct mempool_s *pool, FAR struct mempoolinfo_s *info)
 {
   size_t blocksize = MEMPOOL_REALBLOCKSIZE(pool);
   irqstate_t flags;
+#ifdef MEMPOOL_HAVE_PERCPU
+  size_t count;
+#endif
 
   DEBUGASSERT(pool != NULL && info != NULL);
 
@@ -502,6 +875,11 @@ int mempool_info(FAR struct mempool_s *pool, FAR struct mempoolinfo_s *info)
   info->ordblks = sq_count(&pool->queue);
   info->iordblks = sq_count(&pool->iqueue);
   info->aordblks = pool->nalloc;
+#ifdef MEMPOOL_HAVE_PERCPU
+  count = mempool_percpu_count(pool);
+  info->ordblks += count;
+  info->aordblks -= count;
+#endif
   info->arena = sq_count(&pool->equeue) * MEMPOOL_HEADER_SIZE +
     (info->aordblks + info->ordblks + info->iordblks) * blocksize;
   spin_unlock_irqrestore(&pool->lock, flags);
@@ -541,14 +919,22 @@ mempool_info_task(FAR struct mempool_s *pool,
       size_t count = sq_count(&pool->queue) +
                      sq_count(&pool->iqueue);
 
+#ifdef MEMPOOL_HAVE_PERCPU
+      count += mempool_percpu_count(pool);
+#endif
       spin_unlock_irqrestore(&pool->lock, flags);
       info.aordblks += count;
       info.uordblks += count * blocksize;
     }
   else if (task->pid == PID_MM_ALLOC)
     {
-      info.aordblks += pool->nalloc;
-      info.uordblks += pool->nalloc * blocksize;
+      size_t count = pool->nalloc;
+
+#ifdef MEMPOOL_HAVE_PERCPU
+      count -= mempool_percpu_count(pool);
+#endif
+      info.aordblks += count;
+      info.uordblks += count * blocksize;
     }
 #if CONFIG_MM_BACKTRACE >= 0
   else
@@ -618,6 +1004,25 @@ int mempool_deinit(FAR struct mempool_s *pool)
   FAR sq_entry_t *blk;
   size_t count = 0;
 
+#ifdef MEMPOOL_HAVE_PERCPU
+  /* Give the blocks cached by every CPU back to the shared free list */
+
+  for (count = 0; count < CONFIG_SMP_NCPUS; count++)
+    {
+      FAR struct mempool_percpu_s *percpu = &pool->percpu[count];
+
+      while ((blk = sq_remfirst(&percpu->queue)) != NULL)
+        {
+          sq_addlast(blk, &pool->queue);
+          pool->nalloc--;
+        }
+
+      percpu->nfree = 0;
+    }
+
+  count = 0;
+#endif
+
   if (pool->nalloc != 0)
     {
       return -EBUSY;
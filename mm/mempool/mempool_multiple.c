@@ -29,12 +29,28 @@
 #include <syslog.h>
 #include <sys/param.h>
 
+#include <nuttx/irq.h>
 #include <nuttx/mutex.h>
 #include <nuttx/nuttx.h>
 #include <nuttx/kmalloc.h>
 #include <nuttx/mm/mempool.h>
 #include <nuttx/mm/kasan.h>
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The per-CPU caches are accessed with local interrupts disabled, which is
+ * only possible from the kernel.
+ */
+
+#if defined(CONFIG_MM_HEAP_MEMPOOL_TCACHE) && \
+    (defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__))
+#  define MEMPOOL_HAVE_TCACHE
+#  define MEMPOOL_TCACHE_DEPTH CONFIG_MM_HEAP_MEMPOOL_TCACHE_DEPTH
+#  define MEMPOOL_TCACHE_BATCH ((MEMPOOL_TCACHE_DEPTH + 1) / 2)
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -55,6 +71,16 @@ struct mpool_chunk_s
   size_t used;
 };
 
+#ifdef MEMPOOL_HAVE_TCACHE
+/* A magazine of free blocks of one pool owned by one CPU */
+
+struct mpool_tcache_s
+{
+  size_t    nblks;
+  FAR void *blks[MEMPOOL_TCACHE_DEPTH];
+};
+#endif
+
 struct mempool_multiple_s
 {
   FAR struct mempool_s         *pools;       /* The memory pool array */
@@ -93,6 +119,12 @@ struct mempool_multiple_s
   size_t                        dict_col_num_log2;
   size_t                        dict_row_num;
   FAR struct mpool_dict_s     **dict;
+
+#ifdef MEMPOOL_HAVE_TCACHE
+  /* Per-CPU magazines, indexed by [cpu * npools + pool index] */
+
+  FAR struct mpool_tcache_s    *tcache;
+#endif
 };
 
 /****************************************************************************
@@ -358,6 +390,132 @@ static void mempool_multiple_check(FAR struct mempool_s *pool,
   assert(mempool_multiple_get_dict(pool->priv, blk));
 }
 
+#ifdef MEMPOOL_HAVE_TCACHE
+/****************************************************************************
+ * Name: mempool_multiple_tcache_alloc
+ *
+ * Description:
+ *   Take a block of the given pool from the magazine of the current CPU,
+ *   refilling the magazine from the free queue of the pool in one batch
+ *   when it is empty.  Expanding the pool is left to the caller, since it
+ *   may block.
+ *
+ * Input Parameters:
+ *   mpool - The handle of the multiple memory pool to be used.
+ *   pool  - The memory pool the block should come from.
+ *
+ * Returned Value:
+ *   The pointer to the block; NULL if the pool has no free block.
+ *
+ ****************************************************************************/
+
+static FAR void *
+mempool_multiple_tcache_alloc(FAR struct mempool_multiple_s *mpool,
+                              FAR struct mempool_s *pool)
+{
+  FAR struct mpool_tcache_s *tcache;
+  FAR void *blk = NULL;
+  irqstate_t flags;
+
+  flags  = up_irq_save();
+  tcache = &mpool->tcache[this_cpu() * mpool->npools +
+                          (pool - mpool->pools)];
+
+  if (tcache->nblks == 0)
+    {
+      tcache->nblks = mempool_allocate_batch(pool, tcache->blks,
+                                             MEMPOOL_TCACHE_BATCH);
+    }
+
+  if (tcache->nblks > 0)
+    {
+      blk = tcache->blks[--tcache->nblks];
+    }
+
+  up_irq_restore(flags);
+
+#ifdef CONFIG_MM_FILL_ALLOCATIONS
+  if (blk)
+    {
+      memset(blk, MM_ALLOC_MAGIC, pool->blocksize);
+    }
+#endif
+
+  return blk;
+}
+
+/****************************************************************************
+ * Name: mempool_multiple_tcache_free
+ *
+ * Description:
+ *   Put a block back into the magazine of the current CPU, flushing half
+ *   of the magazine to the pool in one batch when it is full.
+ *
+ * Input Parameters:
+ *   mpool - The handle of the multiple memory pool to be used.
+ *   pool  - The memory pool the block belongs to.
+ *   blk   - The pointer of memory block.
+ *
+ ****************************************************************************/
+
+static void
+mempool_multiple_tcache_free(FAR struct mempool_multiple_s *mpool,
+                             FAR struct mempool_s *pool, FAR void *blk)
+{
+  FAR struct mpool_tcache_s *tcache;
+  irqstate_t flags;
+
+#ifdef CONFIG_MM_FILL_ALLOCATIONS
+  memset(blk, MM_FREE_MAGIC, pool->blocksize);
+#endif
+
+  flags  = up_irq_save();
+  tcache = &mpool->tcache[this_cpu() * mpool->npools +
+                          (pool - mpool->pools)];
+
+  if (tcache->nblks == MEMPOOL_TCACHE_DEPTH)
+    {
+      tcache->nblks -= MEMPOOL_TCACHE_BATCH;
+      mempool_release_batch(pool, &tcache->blks[tcache->nblks],
+                            MEMPOOL_TCACHE_BATCH);
+    }
+
+  tcache->blks[tcache->nblks++] = blk;
+  up_irq_restore(flags);
+}
+
+/****************************************************************************
+ * Name: mempool_multiple_tcache_flush
+ *
+ * Description:
+ *   Return the blocks held in the magazines of all CPUs to their pools.
+ *   The caller must guarantee that no other CPU uses the magazines.
+ *
+ * Input Parameters:
+ *   mpool - The handle of the multiple memory pool to be used.
+ *
+ ****************************************************************************/
+
+static void
+mempool_multiple_tcache_flush(FAR struct mempool_multiple_s *mpool)
+{
+  FAR struct mpool_tcache_s *tcache;
+  size_t i;
+  int cpu;
+
+  for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      for (i = 0; i < mpool->npools; i++)
+        {
+          tcache = &mpool->tcache[cpu * mpool->npools + i];
+          mempool_release_batch(&mpool->pools[i], tcache->blks,
+                                tcache->nblks);
+          tcache->nblks = 0;
+        }
+    }
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -430,7 +588,11 @@ mempool_multiple_init(FAR const char *name,
 
   mpool = alloc(arg, sizeof(uintptr_t),
                 sizeof(struct mempool_multiple_s) +
-                npools * sizeof(struct mempool_s));
+                npools * sizeof(struct mempool_s)
+#ifdef MEMPOOL_HAVE_TCACHE
+                + CONFIG_SMP_NCPUS * npools * sizeof(struct mpool_tcache_s)
+#endif
+                );
 
   if (mpool == NULL)
     {
@@ -450,6 +612,11 @@ mempool_multiple_init(FAR const char *name,
   sq_init(&mpool->chunk_queue);
   mpool->pools = pools;
   mpool->npools = npools;
+#ifdef MEMPOOL_HAVE_TCACHE
+  mpool->tcache = (FAR struct mpool_tcache_s *)(pools + npools);
+  memset(mpool->tcache, 0,
+         CONFIG_SMP_NCPUS * npools * sizeof(struct mpool_tcache_s));
+#endif
   mpool->minpoolsize = minpoolsize;
   mpool->delta = 0;
 
@@ -537,6 +704,7 @@ FAR void *mempool_multiple_alloc(FAR struct mempool_multiple_s *mpool,
 {
   FAR struct mempool_s *end;
   FAR struct mempool_s *pool;
+  FAR void *blk;
 
   pool = mempool_multiple_find(mpool, size);
   if (pool == NULL)
@@ -544,10 +712,18 @@ FAR void *mempool_multiple_alloc(FAR struct mempool_multiple_s *mpool,
       return NULL;
     }
 
+#ifdef MEMPOOL_HAVE_TCACHE
+  blk = mempool_multiple_tcache_alloc(mpool, pool);
+  if (blk)
+    {
+      return blk;
+    }
+#endif
+
   end = mpool->pools + mpool->npools;
   do
     {
-      FAR void *blk = mempool_allocate(pool);
+      blk = mempool_allocate(pool);
 
       if (blk)
         {
@@ -634,7 +810,11 @@ int mempool_multiple_free(FAR struct mempool_multiple_s *mpool,
                             ((FAR char *)kasan_clear_tag(dict->addr) +
                              mpool->minpoolsize)) %
                            MEMPOOL_REALBLOCKSIZE(dict->pool));
+#ifdef MEMPOOL_HAVE_TCACHE
+  mempool_multiple_tcache_free(mpool, dict->pool, blk);
+#else
   mempool_release(dict->pool, blk);
+#endif
   return 0;
 }
 
@@ -870,6 +1050,10 @@ void mempool_multiple_deinit(FAR struct mempool_multiple_s *mpool)
       return;
     }
 
+#ifdef MEMPOOL_HAVE_TCACHE
+  mempool_multiple_tcache_flush(mpool);
+#endif
+
   for (i = 0; i < mpool->npools; i++)
     {
       DEBUGVERIFY(mempool_deinit(mpool->pools + i));
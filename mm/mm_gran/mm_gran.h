@@ -42,10 +42,18 @@
 
 /* Sizes of things */
 
+/* The GAT is followed by a summary bitmap holding one bit per GAT cell.
+ * A bit is set when its cell is fully allocated, so that searches can skip
+ * 32 full cells with a single word test.
+ */
+
 #define SIZEOF_GAT(n) \
   ((n + 31) >> 5)
+#define SIZEOF_GATS(n) \
+  SIZEOF_GAT(SIZEOF_GAT(n))
 #define SIZEOF_GRAN_S(n) \
-  (sizeof(struct gran_s) + sizeof(uint32_t) * (SIZEOF_GAT(n) - 1))
+  (sizeof(struct gran_s) + \
+   sizeof(uint32_t) * (SIZEOF_GAT(n) + SIZEOF_GATS(n) - 1))
 
 /* Debug */
 
@@ -77,7 +85,7 @@ struct gran_s
   mutex_t    lock;       /* For exclusive access to the GAT */
 #endif
   uintptr_t  heapstart; /* The aligned start of the granule heap */
-  uint32_t   gat[1];    /* Start of the granule allocation table */
+  uint32_t   gat[1];    /* Start of the GAT, then the summary bitmap */
 };
 
 /****************************************************************************
@@ -90,10 +90,33 @@ uint32_t lsb_mask(uint32_t n)
   return (-n & n) & GATCFULL;
 }
 
-/* set or clear a GAT cell with given bit mask */
+/* return the index of the least significant set bit of n */
+
+static inline uint32_t cell_ctz(uint32_t n)
+{
+  DEBUGASSERT(n);
+#ifdef CONFIG_HAVE_BUILTIN_CTZ
+  return __builtin_ctz(n);
+#else
+  return DEBRUJIN_LUT[(uint32_t)(lsb_mask(n) * DEBRUJIN_NUM) >> 27];
+#endif
+}
+
+/* return mask of bits at or above bit n of a GAT cell */
+
+static inline uint32_t cell_above(uint32_t n)
+{
+  return GATCFULL << n;
+}
+
+/* set or clear a GAT cell with given bit mask, keeping the summary bit of
+ * the cell in sync.
+ */
 
 static void cell_set(gran_t *gran, uint32_t cell, uint32_t mask, bool val)
 {
+  uint32_t *gats = GATS(gran);
+
   if (val)
     {
       gran->gat[cell] |= mask;
@@ -102,6 +125,92 @@ static void cell_set(gran_t *gran, uint32_t cell, uint32_t mask, bool val)
     {
       gran->gat[cell] &= ~mask;
     }
+
+  if (gran->gat[cell] == GATCFULL)
+    {
+      gats[cell >> 5] |= BIT(cell & 31);
+    }
+  else
+    {
+      gats[cell >> 5] &= ~BIT(cell & 31);
+    }
+}
+
+/* return position of the first free granule at or after posi, or
+ * ngranules if there is none.  Fully allocated cells are skipped 32 at a
+ * time through the summary bitmap.
+ */
+
+static size_t gran_ffz(const gran_t *gran, size_t posi)
+{
+  const uint32_t *gats = GATS(gran);
+  size_t ncells = SIZEOF_GAT(gran->ngranules);
+  size_t c = posi >> 5;
+  size_t s;
+  uint32_t v;
+
+  if (posi >= gran->ngranules)
+    {
+      return gran->ngranules;
+    }
+
+  v = ~gran->gat[c] & cell_above(posi & 31);
+  while (v == 0)
+    {
+      /* Find the next cell that is not fully allocated */
+
+      if (++c >= ncells)
+        {
+          return gran->ngranules;
+        }
+
+      s = c >> 5;
+      v = ~gats[s] & cell_above(c & 31);
+      while (v == 0)
+        {
+          if (++s >= SIZEOF_GAT(ncells))
+            {
+              return gran->ngranules;
+            }
+
+          v = ~gats[s];
+        }
+
+      c = (s << 5) + cell_ctz(v);
+      if (c >= ncells)
+        {
+          return gran->ngranules;
+        }
+
+      v = ~gran->gat[c];
+    }
+
+  posi = (c << 5) + cell_ctz(v);
+  return posi < gran->ngranules ? posi : gran->ngranules;
+}
+
+/* return position of the first used granule in [posi, end), or end if
+ * the whole range is free.
+ */
+
+static size_t gran_ffs(const gran_t *gran, size_t posi, size_t end)
+{
+  size_t c = posi >> 5;
+  uint32_t v;
+
+  v = gran->gat[c] & cell_above(posi & 31);
+  while (v == 0)
+    {
+      if ((++c << 5) >= end)
+        {
+          return end;
+        }
+
+      v = gran->gat[c];
+    }
+
+  posi = (c << 5) + cell_ctz(v);
+  return posi < end ? posi : end;
 }
 
 /* set or clear a range of GAT bits */
@@ -259,24 +368,31 @@ failure:
 
 int gran_search(const gran_t *gran, size_t size)
 {
-  int ret = -EINVAL;
+  size_t posi;
+  size_t used;
 
   if (gran == NULL || gran->ngranules < size)
     {
-      return ret;
+      return -EINVAL;
     }
 
-  ret = -ENOMEM;
-  for (size_t i = 0; i <= gran->ngranules - size; i++)
+  /* Alternate between finding the start of the next free run and the end
+   * of that run, one GAT cell at a time.
+   */
+
+  posi = gran_ffz(gran, 0);
+  while (posi <= gran->ngranules - size)
     {
-      if (gran_match(gran, i, size, 0, &i))
+      used = gran_ffs(gran, posi, posi + size);
+      if (used == posi + size)
         {
-          ret = i;
-          break;
+          return posi;
         }
+
+      posi = gran_ffz(gran, used + 1);
     }
 
-  return ret;
+  return -ENOMEM;
 }
 
 /* set a range of granules */
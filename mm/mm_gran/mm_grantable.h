@@ -58,6 +58,7 @@
 /* GAT table related */
 
 #define GATC_BITS(g)        (sizeof(g->gat[0]) << 3)
+#define GATS(g)             (&(g)->gat[SIZEOF_GAT((g)->ngranules)])
 
 /****************************************************************************
  * Public Types
@@ -27,9 +27,12 @@
 #include <nuttx/config.h>
 
 #include <assert.h>
+#include <stdbool.h>
 
+#include <nuttx/kmalloc.h>
 #include <nuttx/mm/gran.h>
 #include <nuttx/pgalloc.h>
+#include <nuttx/spinlock.h>
 
 #include "mm_gran/mm_gran.h"
 
@@ -71,10 +74,32 @@
 
 static GRAN_HANDLE g_pgalloc;
 
+#ifdef CONFIG_MM_PGALLOC_REFCOUNT
+/* The number of references beyond the first one held on each page of the
+ * pool.  Most pages are mapped only once, so a zero-initialized table
+ * needs no attention on mm_pgalloc().
+ */
+
+static FAR uint16_t *g_pgrefs;
+static uintptr_t g_pgbase;
+static size_t g_pgcount;
+static spinlock_t g_pgref_lock = SP_UNLOCKED;
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+#ifdef CONFIG_MM_PGALLOC_REFCOUNT
+static inline size_t mm_pgindex(uintptr_t paddr)
+{
+  size_t index = (paddr - g_pgbase) >> MM_PGSHIFT;
+
+  DEBUGASSERT(paddr >= g_pgbase && index < g_pgcount);
+  return index;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -100,6 +125,13 @@ void mm_pginitialize(FAR void *heap_start, size_t heap_size)
 {
   g_pgalloc = gran_initialize(heap_start, heap_size, MM_PGSHIFT, MM_PGSHIFT);
   DEBUGASSERT(g_pgalloc != NULL);
+
+#ifdef CONFIG_MM_PGALLOC_REFCOUNT
+  g_pgbase  = MM_PGALIGNUP((uintptr_t)heap_start);
+  g_pgcount = heap_size >> MM_PGSHIFT;
+  g_pgrefs  = kmm_zalloc(g_pgcount * sizeof(uint16_t));
+  DEBUGASSERT(g_pgrefs != NULL);
+#endif
 }
 
 /****************************************************************************
@@ -196,6 +228,93 @@ void mm_pgfree(uintptr_t paddr, unsigned int npages)
   gran_free(g_pgalloc, (FAR void *)paddr, (size_t)npages << MM_PGSHIFT);
 }
 
+#ifdef CONFIG_MM_PGALLOC_REFCOUNT
+/****************************************************************************
+ * Name: mm_pgref
+ *
+ * Description:
+ *   Take an additional reference to a page that is about to be mapped a
+ *   second time, e.g. by a copy-on-write clone of an address environment.
+ *
+ * Input Parameters:
+ *   paddr - The physical address of a page allocated by mm_pgalloc.
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void mm_pgref(uintptr_t paddr)
+{
+  irqstate_t flags;
+  size_t index = mm_pgindex(paddr);
+
+  flags = spin_lock_irqsave(&g_pgref_lock);
+  DEBUGASSERT(g_pgrefs[index] < UINT16_MAX);
+  g_pgrefs[index]++;
+  spin_unlock_irqrestore(&g_pgref_lock, flags);
+}
+
+/****************************************************************************
+ * Name: mm_pgunref
+ *
+ * Description:
+ *   Drop one reference to a page.  The page is returned to the page memory
+ *   pool when its last reference is dropped.
+ *
+ * Input Parameters:
+ *   paddr - The physical address of a page allocated by mm_pgalloc.
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void mm_pgunref(uintptr_t paddr)
+{
+  irqstate_t flags;
+  size_t index = mm_pgindex(paddr);
+  bool last = false;
+
+  flags = spin_lock_irqsave(&g_pgref_lock);
+  if (g_pgrefs[index] > 0)
+    {
+      g_pgrefs[index]--;
+    }
+  else
+    {
+      last = true;
+    }
+
+  spin_unlock_irqrestore(&g_pgref_lock, flags);
+
+  if (last)
+    {
+      mm_pgfree(paddr, 1);
+    }
+}
+
+/****************************************************************************
+ * Name: mm_pgrefs
+ *
+ * Description:
+ *   Return the number of references to a page.  A freshly allocated page
+ *   has one reference.
+ *
+ * Input Parameters:
+ *   paddr - The physical address of a page allocated by mm_pgalloc.
+ *
+ * Returned Value:
+ *   The number of references to the page.
+ *
+ ****************************************************************************/
+
+unsigned int mm_pgrefs(uintptr_t paddr)
+{
+  return g_pgrefs[mm_pgindex(paddr)] + 1;
+}
+#endif
+
 /****************************************************************************
  * Name: mm_pginfo
  *
@@ -29,14 +29,17 @@
 
 #include <nuttx/config.h>
 
+#include <nuttx/atomic.h>
 #include <nuttx/mutex.h>
 #include <nuttx/sched.h>
+#include <nuttx/spinlock.h>
 #include <nuttx/fs/procfs.h>
 #include <nuttx/lib/math32.h>
 #include <nuttx/mm/mempool.h>
 #include <nuttx/mm/mm.h>
 
 #include <assert.h>
+#include <sys/param.h>
 #include <sys/types.h>
 #include <stdbool.h>
 #include <string.h>
@@ -109,6 +112,14 @@
 #  define MM_ADD_BACKTRACE(heap, ptr)
 #endif
 
+#ifdef CONFIG_MM_HEAP_PROFILE
+#  define MM_PROFILE_ALLOC(heap, mem, size) mm_profile_alloc(heap, mem, size)
+#  define MM_PROFILE_FREE(heap, mem)        mm_profile_free(heap, mem)
+#else
+#  define MM_PROFILE_ALLOC(heap, mem, size)
+#  define MM_PROFILE_FREE(heap, mem)
+#endif
+
 /* All other definitions derive from these two */
 
 #define MM_MIN_CHUNK     (1 << MM_MIN_SHIFT)
@@ -214,6 +225,43 @@ struct mm_delaynode_s
   FAR struct mm_delaynode_s *flink;
 };
 
+#ifdef CONFIG_MM_HEAP_PROFILE
+/* This describes one call stack of the heap profile */
+
+struct mm_profstack_s
+{
+  uint32_t hash;                                  /* 0 if unused */
+  uint8_t  depth;
+  size_t   allocobjs;
+  size_t   allocbytes;
+  size_t   inuseobjs;
+  size_t   inusebytes;
+  FAR void *stack[CONFIG_MM_HEAP_PROFILE_DEPTH];
+};
+
+/* This describes one sampled allocation which is not yet freed */
+
+struct mm_proflive_s
+{
+  FAR void *mem;                                  /* NULL if unused */
+  uint16_t  stack;                                /* Index in mp_stacks */
+  size_t    objs;                                 /* Estimated objects */
+  size_t    bytes;                                /* Estimated bytes */
+};
+
+/* This describes the heap profile state of one heap */
+
+struct mm_profile_s
+{
+  atomic_t              mp_left;    /* Bytes left until the next sample */
+  spinlock_t            mp_lock;    /* Protects the fields below */
+  size_t                mp_nlive;   /* Number of entries in mp_live */
+  unsigned long         mp_dropped; /* Samples lost to full tables */
+  struct mm_profstack_s mp_stacks[CONFIG_MM_HEAP_PROFILE_NSTACKS];
+  struct mm_proflive_s  mp_live[CONFIG_MM_HEAP_PROFILE_NLIVE];
+};
+#endif
+
 /* This describes one heap (possibly with multiple regions) */
 
 struct mm_heap_s
@@ -265,6 +313,21 @@ struct mm_heap_s
   FAR struct mempool_multiple_s *mm_mpool;
 #endif
 
+#ifdef CONFIG_MM_HEAP_FRAGSTATS
+  /* Fragmentation samples, taken every CONFIG_MM_HEAP_FRAGSTATS_INTERVAL
+   * allocations.  mm_fraghist is a ring indexed by mm_nsamples.
+   */
+
+  size_t        mm_nallocs;
+  size_t        mm_minlargest;
+  unsigned long mm_nsamples;
+  size_t        mm_fraghist[CONFIG_MM_HEAP_FRAGSTATS_HISTORY];
+#endif
+
+#ifdef CONFIG_MM_HEAP_PROFILE
+  struct mm_profile_s mm_profile;
+#endif
+
 #if defined(CONFIG_FS_PROCFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_MEMINFO)
   struct procfs_meminfo_entry_s mm_procfs;
 #endif
@@ -296,10 +359,31 @@ void mm_shrinkchunk(FAR struct mm_heap_s *heap,
 void mm_foreach(FAR struct mm_heap_s *heap, mm_node_handler_t handler,
                 FAR void *arg);
 
+/* Functions contained in mm_mallinfo.c *************************************/
+
+#ifdef CONFIG_MM_HEAP_FRAGSTATS
+size_t mm_largest_freechunk(FAR struct mm_heap_s *heap);
+void mm_fragsample(FAR struct mm_heap_s *heap);
+#endif
+
+/* Functions contained in mm_malloc.c ***************************************/
+
+FAR void *mm_malloc_internal(FAR struct mm_heap_s *heap, size_t size,
+                             bool longlived);
+
 /* Functions contained in mm_free.c *****************************************/
 
 void mm_delayfree(FAR struct mm_heap_s *heap, FAR void *mem, bool delay);
 
+/* Functions contained in mm_profile.c **************************************/
+
+#ifdef CONFIG_MM_HEAP_PROFILE
+void mm_profile_init(FAR struct mm_heap_s *heap);
+void mm_profile_sample(FAR struct mm_heap_s *heap, FAR void *mem,
+                       size_t size);
+void mm_profile_untrack(FAR struct mm_heap_s *heap, FAR void *mem);
+#endif
+
 /****************************************************************************
  * Inline Functions
  ****************************************************************************/
@@ -352,4 +436,36 @@ static inline_function void mm_addfreechunk(FAR struct mm_heap_s *heap,
     }
 }
 
+#ifdef CONFIG_MM_HEAP_PROFILE
+/* Count down the bytes until the next sample.  Only the allocation that
+ * crosses zero takes the slow path, so the cost of an unsampled
+ * allocation is a single atomic subtraction.
+ */
+
+static inline_function void mm_profile_alloc(FAR struct mm_heap_s *heap,
+                                             FAR void *mem, size_t size)
+{
+  int32_t step = MIN(size, CONFIG_MM_HEAP_PROFILE_RATE);
+  int32_t left;
+
+  if (mem != NULL)
+    {
+      left = atomic_fetch_sub(&heap->mm_profile.mp_left, step);
+      if (left > 0 && left <= step)
+        {
+          mm_profile_sample(heap, mem, size);
+        }
+    }
+}
+
+static inline_function void mm_profile_free(FAR struct mm_heap_s *heap,
+                                            FAR void *mem)
+{
+  if (heap->mm_profile.mp_nlive > 0)
+    {
+      mm_profile_untrack(heap, mem);
+    }
+}
+#endif
+
 #endif /* __MM_MM_HEAP_MM_H */
@@ -241,6 +241,7 @@ void mm_free(FAR struct mm_heap_s *heap, FAR void *mem)
     }
 
   DEBUGASSERT(mm_heapmember(heap, mem));
+  MM_PROFILE_FREE(heap, mem);
 
 #ifdef CONFIG_MM_HEAP_MEMPOOL
   if (heap->mm_mpool)
@@ -28,6 +28,8 @@
 
 #include <assert.h>
 #include <debug.h>
+#include <string.h>
+#include <sys/param.h>
 
 #include <nuttx/mm/mm.h>
 
@@ -193,6 +195,107 @@ size_t mm_heapfree(FAR struct mm_heap_s *heap)
   return heap->mm_heapsize - heap->mm_curused;
 }
 
+#ifdef CONFIG_MM_HEAP_FRAGSTATS
+/****************************************************************************
+ * Name: mm_largest_freechunk
+ *
+ * Description:
+ *   Return the size of the largest free chunk.  The free list is sorted by
+ *   size within each size class, so this is the last node of the highest
+ *   non-empty size class.  The caller must hold the heap lock.
+ *
+ ****************************************************************************/
+
+size_t mm_largest_freechunk(FAR struct mm_heap_s *heap)
+{
+  FAR struct mm_freenode_s *node;
+  int ndx;
+
+  for (ndx = MM_NNODES - 1; ndx >= 0; ndx--)
+    {
+      node = heap->mm_nodelist[ndx].flink;
+      if (node == NULL || node->size == 0)
+        {
+          continue;
+        }
+
+      while (node->flink != NULL && node->flink->size != 0)
+        {
+          node = node->flink;
+        }
+
+      return MM_SIZEOF_NODE(node);
+    }
+
+  return 0;
+}
+
+/****************************************************************************
+ * Name: mm_fragsample
+ *
+ * Description:
+ *   Record the current largest free chunk in the fragmentation history.
+ *   The caller must hold the heap lock.
+ *
+ ****************************************************************************/
+
+void mm_fragsample(FAR struct mm_heap_s *heap)
+{
+  size_t largest = mm_largest_freechunk(heap);
+
+  if (heap->mm_nsamples == 0 || largest < heap->mm_minlargest)
+    {
+      heap->mm_minlargest = largest;
+    }
+
+  heap->mm_fraghist[heap->mm_nsamples++ %
+                    CONFIG_MM_HEAP_FRAGSTATS_HISTORY] = largest;
+  heap->mm_nallocs = 0;
+}
+
+/****************************************************************************
+ * Name: mm_fraginfo
+ *
+ * Description:
+ *   Return the fragmentation statistics of the heap.  The fragmentation
+ *   index is the percentage of the free memory that is not part of the
+ *   largest free chunk: 0 means that all free memory is contiguous.
+ *
+ ****************************************************************************/
+
+void mm_fraginfo(FAR struct mm_heap_s *heap, FAR struct mm_fraginfo_s *info)
+{
+  unsigned long first;
+  unsigned int i;
+
+  memset(info, 0, sizeof(*info));
+
+  DEBUGVERIFY(mm_lock(heap));
+
+  info->free    = heap->mm_heapsize - heap->mm_curused;
+  info->largest = mm_largest_freechunk(heap);
+  if (info->free > info->largest)
+    {
+      info->index = (uint64_t)(info->free - info->largest) * 100 /
+                    info->free;
+    }
+
+  info->minlargest = heap->mm_nsamples > 0 &&
+                     heap->mm_minlargest < info->largest ?
+                     heap->mm_minlargest : info->largest;
+
+  info->nhistory = MIN(heap->mm_nsamples, CONFIG_MM_HEAP_FRAGSTATS_HISTORY);
+  first = heap->mm_nsamples - info->nhistory;
+  for (i = 0; i < info->nhistory; i++)
+    {
+      info->history[i] = heap->mm_fraghist[(first + i) %
+                                           CONFIG_MM_HEAP_FRAGSTATS_HISTORY];
+    }
+
+  mm_unlock(heap);
+}
+#endif
+
 /****************************************************************************
  * Name: mm_heapfree_largest
  *
@@ -137,37 +137,21 @@ void mm_mempool_dump_handle(FAR struct mempool_s *pool, FAR void *arg)
 #endif
 
 /****************************************************************************
- * Public Functions
- ****************************************************************************/
-
-/****************************************************************************
- * Name: mm_free_delaylist
- *
- * Description:
- *   force freeing the delaylist of this heap.
- *
- ****************************************************************************/
-
-void mm_free_delaylist(FAR struct mm_heap_s *heap)
-{
-  if (heap)
-    {
-       free_delaylist(heap, true);
-    }
-}
-
-/****************************************************************************
- * Name: mm_malloc
+ * Name: mm_malloc_internal
  *
  * Description:
  *  Find the smallest chunk that satisfies the request. Take the memory from
- *  that chunk, save the remaining, smaller chunk (if any).
+ *  that chunk, save the remaining, smaller chunk (if any).  Long-lived
+ *  allocations are taken from the top of the chunk so that they do not
+ *  interleave with the short-lived ones taken from the bottom.
  *
- *  8-byte alignment of the allocated data is assured.
+ *  8-byte alignment of the allocated data is assured.  The allocation is
+ *  not reported to the heap profiler.
  *
  ****************************************************************************/
 
-FAR void *mm_malloc(FAR struct mm_heap_s *heap, size_t size)
+FAR void *mm_malloc_internal(FAR struct mm_heap_s *heap, size_t size,
+                             bool longlived)
 {
   FAR struct mm_freenode_s *node;
   size_t alignsize;
@@ -179,6 +163,13 @@ FAR void *mm_malloc(FAR struct mm_heap_s *heap, size_t size)
 
   free_delaylist(heap, false);
 
+#if defined(CONFIG_MM_HEAP_LIFETIME) && CONFIG_MM_HEAP_LIFETIME_THRESHOLD > 0
+  if (size >= CONFIG_MM_HEAP_LIFETIME_THRESHOLD)
+    {
+      longlived = true;
+    }
+#endif
+
 #ifdef CONFIG_MM_HEAP_MEMPOOL
   if (heap->mm_mpool)
     {
@@ -275,6 +266,34 @@ FAR void *mm_malloc(FAR struct mm_heap_s *heap, size_t size)
        */
 
       remaining = nodesize - alignsize;
+#ifdef CONFIG_MM_HEAP_LIFETIME
+      if (longlived && remaining >= MM_MIN_CHUNK)
+        {
+          FAR struct mm_allocnode_s *alloc;
+
+          /* Keep the bottom of the chunk free and allocate its top.  The
+           * free node cannot have a free predecessor, so no flag bits
+           * need to be preserved.
+           */
+
+          alloc = (FAR struct mm_allocnode_s *)
+            (((FAR char *)node) + remaining);
+
+          node->size       = remaining;
+          alloc->preceding = remaining;
+          alloc->size      = alignsize | MM_PREVFREE_BIT;
+
+          /* The next node now follows an allocated node */
+
+          next->size &= ~MM_PREVFREE_BIT;
+
+          /* Add the bottom part back into the nodelist */
+
+          mm_addfreechunk(heap, node);
+          node = (FAR struct mm_freenode_s *)alloc;
+        }
+      else
+#endif
       if (remaining >= MM_MIN_CHUNK)
         {
           /* Create the remainder node */
@@ -320,6 +339,13 @@ FAR void *mm_malloc(FAR struct mm_heap_s *heap, size_t size)
       ret = (FAR void *)((FAR char *)node + MM_SIZEOF_ALLOCNODE);
     }
 
+#ifdef CONFIG_MM_HEAP_FRAGSTATS
+  if (++heap->mm_nallocs >= CONFIG_MM_HEAP_FRAGSTATS_INTERVAL)
+    {
+      mm_fragsample(heap);
+    }
+#endif
+
   DEBUGASSERT(ret == NULL || mm_heapmember(heap, ret));
 
   if (ret)
@@ -347,7 +373,7 @@ FAR void *mm_malloc(FAR struct mm_heap_s *heap, size_t size)
 
   else if (free_delaylist(heap, true))
     {
-      return mm_malloc(heap, size);
+      return mm_malloc_internal(heap, size, longlived);
     }
 #endif
 
@@ -411,3 +437,61 @@ FAR void *mm_malloc(FAR struct mm_heap_s *heap, size_t size)
   DEBUGASSERT(ret == NULL || ((uintptr_t)ret) % MM_ALIGN == 0);
   return ret;
 }
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mm_free_delaylist
+ *
+ * Description:
+ *   force freeing the delaylist of this heap.
+ *
+ ****************************************************************************/
+
+void mm_free_delaylist(FAR struct mm_heap_s *heap)
+{
+  if (heap)
+    {
+       free_delaylist(heap, true);
+    }
+}
+
+/****************************************************************************
+ * Name: mm_malloc
+ *
+ * Description:
+ *  Find the smallest chunk that satisfies the request. Take the memory from
+ *  that chunk, save the remaining, smaller chunk (if any).
+ *
+ *  8-byte alignment of the allocated data is assured.
+ *
+ ****************************************************************************/
+
+FAR void *mm_malloc(FAR struct mm_heap_s *heap, size_t size)
+{
+  FAR void *ret = mm_malloc_internal(heap, size, false);
+
+  MM_PROFILE_ALLOC(heap, ret, size);
+  return ret;
+}
+
+#ifdef CONFIG_MM_HEAP_LIFETIME
+/****************************************************************************
+ * Name: mm_malloc_longlived
+ *
+ * Description:
+ *  Same as mm_malloc(), but hint that the memory will be kept for a long
+ *  time so that it is placed away from short-lived allocations.
+ *
+ ****************************************************************************/
+
+FAR void *mm_malloc_longlived(FAR struct mm_heap_s *heap, size_t size)
+{
+  FAR void *ret = mm_malloc_internal(heap, size, true);
+
+  MM_PROFILE_ALLOC(heap, ret, size);
+  return ret;
+}
+#endif
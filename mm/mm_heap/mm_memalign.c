@@ -82,6 +82,7 @@ FAR void *mm_memalign(FAR struct mm_heap_s *heap, size_t alignment,
       node = mempool_multiple_memalign(heap->mm_mpool, alignment, size);
       if (node != NULL)
         {
+          MM_PROFILE_ALLOC(heap, node, size);
           return node;
         }
     }
@@ -131,9 +132,11 @@ FAR void *mm_memalign(FAR struct mm_heap_s *heap, size_t alignment,
       return NULL;
     }
 
-  /* Then malloc that size */
+  /* Then malloc that size.  Only the aligned chunk returned below is
+   * reported to the heap profiler.
+   */
 
-  rawchunk = (uintptr_t)mm_malloc(heap, allocsize);
+  rawchunk = (uintptr_t)mm_malloc_internal(heap, allocsize, false);
   if (rawchunk == 0)
     {
       return NULL;
@@ -290,5 +293,7 @@ FAR void *mm_memalign(FAR struct mm_heap_s *heap, size_t alignment,
   DEBUGASSERT(alignedchunk % alignment == 0);
   minfo("Aligned %"PRIxPTR" to %"PRIxPTR", size %zu\n",
         rawchunk, alignedchunk, size);
+  MM_PROFILE_ALLOC(heap, (FAR void *)alignedchunk,
+                   size - MM_ALLOCNODE_OVERHEAD);
   return (FAR void *)alignedchunk;
 }
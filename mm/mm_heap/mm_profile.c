@@ -0,0 +1,364 @@
+/****************************************************************************
+ * mm/mm_heap/mm_profile.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <assert.h>
+#include <sched.h>
+#include <string.h>
+
+#include <nuttx/atomic.h>
+#include <nuttx/spinlock.h>
+#include <nuttx/mm/mm.h>
+
+#include "mm_heap/mm.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define MM_PROFILE_NSTACKS CONFIG_MM_HEAP_PROFILE_NSTACKS
+#define MM_PROFILE_NLIVE   CONFIG_MM_HEAP_PROFILE_NLIVE
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mm_profile_hash
+ *
+ * Description:
+ *   FNV-1a hash of a call stack.  0 marks an unused slot, so it is never
+ *   returned.
+ *
+ ****************************************************************************/
+
+static uint32_t mm_profile_hash(FAR void * const *stack, int depth)
+{
+  uint32_t hash = 2166136261u;
+  int i;
+
+  for (i = 0; i < depth; i++)
+    {
+      uintptr_t pc = (uintptr_t)stack[i];
+      size_t j;
+
+      for (j = 0; j < sizeof(pc); j++)
+        {
+          hash ^= (uint8_t)(pc >> (j * 8));
+          hash *= 16777619u;
+        }
+    }
+
+  return hash != 0 ? hash : 1;
+}
+
+/****************************************************************************
+ * Name: mm_profile_home
+ *
+ * Description:
+ *   Return the first slot probed for a sampled allocation in mp_live.
+ *
+ ****************************************************************************/
+
+static size_t mm_profile_home(FAR const void *mem)
+{
+  return (uint32_t)((uintptr_t)mem / MM_ALIGN * 2654435761u) %
+         MM_PROFILE_NLIVE;
+}
+
+/****************************************************************************
+ * Name: mm_profile_findstack
+ *
+ * Description:
+ *   Return the slot of a call stack in mp_stacks, claiming an unused one
+ *   for a new call stack.  Returns -1 if the table is full.  Called with
+ *   mp_lock held.
+ *
+ ****************************************************************************/
+
+static int mm_profile_findstack(FAR struct mm_profile_s *prof,
+                                FAR void * const *stack, int depth,
+                                uint32_t hash)
+{
+  FAR struct mm_profstack_s *slot;
+  int ndx = hash % MM_PROFILE_NSTACKS;
+  int i;
+
+  for (i = 0; i < MM_PROFILE_NSTACKS; i++)
+    {
+      slot = &prof->mp_stacks[ndx];
+      if (slot->hash == 0)
+        {
+          slot->hash  = hash;
+          slot->depth = depth;
+          memcpy(slot->stack, stack, depth * sizeof(FAR void *));
+          return ndx;
+        }
+      else if (slot->hash == hash && slot->depth == depth &&
+               memcmp(slot->stack, stack, depth * sizeof(FAR void *)) == 0)
+        {
+          return ndx;
+        }
+
+      if (++ndx >= MM_PROFILE_NSTACKS)
+        {
+          ndx = 0;
+        }
+    }
+
+  return -1;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mm_profile_init
+ *
+ * Description:
+ *   Arm the sampling of a newly initialized heap.
+ *
+ ****************************************************************************/
+
+void mm_profile_init(FAR struct mm_heap_s *heap)
+{
+  spin_lock_init(&heap->mm_profile.mp_lock);
+  atomic_set(&heap->mm_profile.mp_left, CONFIG_MM_HEAP_PROFILE_RATE);
+}
+
+/****************************************************************************
+ * Name: mm_profile_sample
+ *
+ * Description:
+ *   Record the call stack of an allocation which crossed the sampling
+ *   interval.  The sample stands for the CONFIG_MM_HEAP_PROFILE_RATE bytes
+ *   allocated since the previous one, so an allocation smaller than that
+ *   is accounted as RATE / size objects of the same size.
+ *
+ ****************************************************************************/
+
+void mm_profile_sample(FAR struct mm_heap_s *heap, FAR void *mem,
+                       size_t size)
+{
+  FAR struct mm_profile_s *prof = &heap->mm_profile;
+  FAR void *stack[CONFIG_MM_HEAP_PROFILE_DEPTH];
+  FAR struct mm_profstack_s *slot;
+  irqstate_t flags;
+  uint32_t hash;
+  size_t bytes;
+  size_t objs;
+  size_t i;
+  int depth;
+  int ndx;
+
+  /* Re-arm first so that other threads keep counting down meanwhile */
+
+  atomic_fetch_add(&prof->mp_left, CONFIG_MM_HEAP_PROFILE_RATE);
+
+  if (size >= CONFIG_MM_HEAP_PROFILE_RATE)
+    {
+      objs  = 1;
+      bytes = size;
+    }
+  else
+    {
+      objs  = CONFIG_MM_HEAP_PROFILE_RATE / size;
+      bytes = CONFIG_MM_HEAP_PROFILE_RATE;
+    }
+
+  depth = sched_backtrace(_SCHED_GETTID(), stack,
+                          CONFIG_MM_HEAP_PROFILE_DEPTH,
+                          CONFIG_MM_HEAP_PROFILE_SKIP);
+  if (depth < 0)
+    {
+      depth = 0;
+    }
+
+  hash  = mm_profile_hash(stack, depth);
+  flags = spin_lock_irqsave(&prof->mp_lock);
+
+  ndx = mm_profile_findstack(prof, stack, depth, hash);
+  if (ndx < 0)
+    {
+      prof->mp_dropped++;
+      goto out;
+    }
+
+  slot = &prof->mp_stacks[ndx];
+  slot->allocobjs  += objs;
+  slot->allocbytes += bytes;
+
+  /* The in use counts can only be kept if the free can be matched */
+
+  if (prof->mp_nlive >= MM_PROFILE_NLIVE)
+    {
+      prof->mp_dropped++;
+      goto out;
+    }
+
+  for (i = mm_profile_home(mem); prof->mp_live[i].mem != NULL; )
+    {
+      if (++i >= MM_PROFILE_NLIVE)
+        {
+          i = 0;
+        }
+    }
+
+  prof->mp_live[i].mem   = mem;
+  prof->mp_live[i].stack = ndx;
+  prof->mp_live[i].objs  = objs;
+  prof->mp_live[i].bytes = bytes;
+  prof->mp_nlive++;
+
+  slot->inuseobjs  += objs;
+  slot->inusebytes += bytes;
+
+out:
+  spin_unlock_irqrestore(&prof->mp_lock, flags);
+}
+
+/****************************************************************************
+ * Name: mm_profile_untrack
+ *
+ * Description:
+ *   Remove a freed allocation from the in use counts if it was sampled.
+ *
+ ****************************************************************************/
+
+void mm_profile_untrack(FAR struct mm_heap_s *heap, FAR void *mem)
+{
+  FAR struct mm_profile_s *prof = &heap->mm_profile;
+  FAR struct mm_profstack_s *slot;
+  irqstate_t flags;
+  size_t home;
+  size_t i;
+  size_t j;
+  size_t n;
+
+  flags = spin_lock_irqsave(&prof->mp_lock);
+
+  for (i = mm_profile_home(mem), n = 0;
+       n < MM_PROFILE_NLIVE && prof->mp_live[i].mem != NULL; n++)
+    {
+      if (prof->mp_live[i].mem == mem)
+        {
+          break;
+        }
+
+      if (++i >= MM_PROFILE_NLIVE)
+        {
+          i = 0;
+        }
+    }
+
+  if (n >= MM_PROFILE_NLIVE || prof->mp_live[i].mem != mem)
+    {
+      goto out;
+    }
+
+  slot = &prof->mp_stacks[prof->mp_live[i].stack];
+  slot->inuseobjs  -= prof->mp_live[i].objs;
+  slot->inusebytes -= prof->mp_live[i].bytes;
+  prof->mp_nlive--;
+
+  /* Shift the following entries of the probe sequence back, so that the
+   * lookup above never needs tombstones.
+   */
+
+  for (j = i, n = 1; n < MM_PROFILE_NLIVE; n++)
+    {
+      if (++j >= MM_PROFILE_NLIVE)
+        {
+          j = 0;
+        }
+
+      if (prof->mp_live[j].mem == NULL)
+        {
+          break;
+        }
+
+      home = mm_profile_home(prof->mp_live[j].mem);
+      if ((j > i && (home <= i || home > j)) ||
+          (j < i && home <= i && home > j))
+        {
+          prof->mp_live[i] = prof->mp_live[j];
+          i = j;
+        }
+    }
+
+  prof->mp_live[i].mem = NULL;
+
+out:
+  spin_unlock_irqrestore(&prof->mp_lock, flags);
+}
+
+/****************************************************************************
+ * Name: mm_profile
+ *
+ * Description:
+ *   Report each call stack recorded by the heap profiler of a heap.
+ *
+ * Input Parameters:
+ *   heap    - The heap to report
+ *   handler - Called once for each call stack, without any lock held
+ *   arg     - Passed to the handler
+ *
+ ****************************************************************************/
+
+void mm_profile(FAR struct mm_heap_s *heap, mm_profile_handler_t handler,
+                FAR void *arg)
+{
+  FAR struct mm_profile_s *prof = &heap->mm_profile;
+  FAR struct mm_profstack_s *slot;
+  struct mm_profsample_s sample;
+  irqstate_t flags;
+  int i;
+
+  DEBUGASSERT(handler != NULL);
+
+  for (i = 0; i < MM_PROFILE_NSTACKS; i++)
+    {
+      slot  = &prof->mp_stacks[i];
+      flags = spin_lock_irqsave(&prof->mp_lock);
+      if (slot->hash == 0)
+        {
+          spin_unlock_irqrestore(&prof->mp_lock, flags);
+          continue;
+        }
+
+      sample.allocobjs  = slot->allocobjs;
+      sample.allocbytes = slot->allocbytes;
+      sample.inuseobjs  = slot->inuseobjs;
+      sample.inusebytes = slot->inusebytes;
+      sample.depth      = slot->depth;
+      memcpy(sample.stack, slot->stack, slot->depth * sizeof(FAR void *));
+      spin_unlock_irqrestore(&prof->mp_lock, flags);
+
+      handler(&sample, arg);
+    }
+}
@@ -92,6 +92,8 @@ FAR void *mm_realloc(FAR struct mm_heap_s *heap, FAR void *oldmem,
       newmem = mempool_multiple_realloc(heap->mm_mpool, oldmem, size);
       if (newmem != NULL)
         {
+          MM_PROFILE_FREE(heap, oldmem);
+          MM_PROFILE_ALLOC(heap, newmem, size);
           return newmem;
         }
       else if (size <= heap->mm_threshold ||
@@ -161,6 +163,8 @@ FAR void *mm_realloc(FAR struct mm_heap_s *heap, FAR void *oldmem,
 
       mm_unlock(heap);
       MM_ADD_BACKTRACE(heap, oldnode);
+      MM_PROFILE_FREE(heap, oldmem);
+      MM_PROFILE_ALLOC(heap, oldmem, size);
 
       return oldmem;
     }
@@ -392,6 +396,7 @@ FAR void *mm_realloc(FAR struct mm_heap_s *heap, FAR void *oldmem,
       size = MM_SIZEOF_NODE(oldnode);
       mm_unlock(heap);
       MM_ADD_BACKTRACE(heap, (FAR char *)newmem - MM_SIZEOF_ALLOCNODE);
+      MM_PROFILE_FREE(heap, oldmem);
 
       newmem = kasan_unpoison(newmem, size - MM_ALLOCNODE_OVERHEAD);
 
@@ -405,6 +410,7 @@ FAR void *mm_realloc(FAR struct mm_heap_s *heap, FAR void *oldmem,
           memcpy(newmem, oldmem, oldsize - MM_ALLOCNODE_OVERHEAD);
         }
 
+      MM_PROFILE_ALLOC(heap, newmem, size - MM_ALLOCNODE_OVERHEAD);
       return newmem;
     }
 
@@ -52,3 +52,25 @@ FAR void *mm_zalloc(FAR struct mm_heap_s *heap, size_t size)
 
   return alloc;
 }
+
+#ifdef CONFIG_MM_HEAP_LIFETIME
+/****************************************************************************
+ * Name: mm_zalloc_longlived
+ *
+ * Description:
+ *   mm_zalloc_longlived calls mm_malloc_longlived, then zeroes out the
+ *   allocated chunk.
+ *
+ ****************************************************************************/
+
+FAR void *mm_zalloc_longlived(FAR struct mm_heap_s *heap, size_t size)
+{
+  FAR void *alloc = mm_malloc_longlived(heap, size);
+  if (alloc)
+    {
+      memset(alloc, 0, size);
+    }
+
+  return alloc;
+}
+#endif
@@ -59,6 +59,9 @@ int devif_iob_send(FAR struct net_driver_s *dev, FAR struct iob_s *iob,
                    unsigned int len, unsigned int offset,
                    unsigned int target_offset)
 {
+#ifndef CONFIG_NET_IPFRAG
+  unsigned int maxlen;
+#endif
   int ret;
 
   if (dev == NULL)
@@ -74,7 +77,15 @@ int devif_iob_send(FAR struct net_driver_s *dev, FAR struct iob_s *iob,
     }
 
 #ifndef CONFIG_NET_IPFRAG
-  if (len > NETDEV_PKTSIZE(dev) - NET_LL_HDRLEN(dev) - target_offset)
+  maxlen = NETDEV_PKTSIZE(dev) - NET_LL_HDRLEN(dev);
+#ifdef CONFIG_NET_TCP_GSO
+  if (dev->d_gso_max > maxlen)
+    {
+      maxlen = dev->d_gso_max;
+    }
+#endif
+
+  if (len > maxlen - target_offset)
     {
       ret = -EMSGSIZE;
       goto errout;
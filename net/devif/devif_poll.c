@@ -774,6 +774,9 @@ static int devif_poll_connections(FAR struct net_driver_s *dev,
   /* Reset device buffer length */
 
   dev->d_len = 0;
+#ifdef CONFIG_NET_TCP_GSO
+  dev->d_gso_size = 0;
+#endif
 
   /* Traverse all of the active packet connections and perform the poll
    * action.
@@ -115,8 +115,9 @@ void icmpv6_reply(FAR struct net_driver_s *dev, int type, int code, int data)
 
   /* Save the original datagram */
 
-  if (CONFIG_IOB_BUFSIZE >= datalen + ipicmplen +
-                            CONFIG_NET_LL_GUARDSIZE)
+  if (dev->d_iob->io_len == datalen &&
+      IOB_BUFSIZE(dev->d_iob) >= dev->d_iob->io_offset + datalen +
+                                 ipicmplen)
     {
       /* Reuse current iob */
 
@@ -297,6 +297,22 @@ uint16_t ipv4_build_header(FAR struct ipv4_hdr_s *ipv4, uint16_t total_len,
                            uint8_t tos, FAR struct ipv4_opt_s *opt);
 #endif
 
+/****************************************************************************
+ * Name: ipv4_reserve_ipid
+ *
+ * Description:
+ *   Skip count IP IDs after the one of the last header built, so that the
+ *   segments split from a TCP super-segment can take them.
+ *
+ * Input Parameters:
+ *   count      Number of IP IDs to skip
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_TCP_GSO)
+void ipv4_reserve_ipid(uint16_t count);
+#endif
+
 /****************************************************************************
  * Name: ipv6_build_header
  *
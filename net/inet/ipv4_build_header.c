@@ -111,4 +111,20 @@ uint16_t ipv4_build_header(FAR struct ipv4_hdr_s *ipv4, uint16_t total_len,
   return (ipv4->vhl & IPv4_HLMASK) << 2;
 }
 
+/****************************************************************************
+ * Name: ipv4_reserve_ipid
+ *
+ * Description:
+ *   Skip count IP IDs after the one of the last header built, so that the
+ *   segments split from a TCP super-segment can take them.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_GSO
+void ipv4_reserve_ipid(uint16_t count)
+{
+  g_ipid += count;
+}
+#endif
+
 #endif /* CONFIG_NET_IPv4 */
@@ -32,6 +32,7 @@
 #include <sys/types.h>
 
 #include <nuttx/clock.h>
+#include <nuttx/hashtable.h>
 #include <nuttx/queue.h>
 #include <nuttx/semaphore.h>
 #include <nuttx/mm/iob.h>
@@ -69,7 +70,7 @@
 #  define TCP_WBPKTLEN(wrb)          ((wrb)->wb_iob->io_pktlen)
 #  define TCP_WBSENT(wrb)            ((wrb)->wb_sent)
 #  define TCP_WBNRTX(wrb)            ((wrb)->wb_nrtx)
-#if defined(CONFIG_NET_TCP_FAST_RETRANSMIT) && !defined(CONFIG_NET_TCP_CC_NEWRENO)
+#if defined(CONFIG_NET_TCP_FAST_RETRANSMIT) && !defined(CONFIG_NET_TCP_CC)
 #  define TCP_WBNACK(wrb)            ((wrb)->wb_nack)
 #endif
 #  define TCP_WBIOB(wrb)             ((wrb)->wb_iob)
@@ -106,7 +107,7 @@
 #define TCP_SACK              0x02U /* Selective ACKs enabled */
 #define TCP_CLOSE_ARRANGED    0x04U /* Connection is arranged to be freed */
 
-#ifdef CONFIG_NET_TCP_CC_NEWRENO
+#ifdef CONFIG_NET_TCP_CC
 /* The TCP flags for congestion control */
 
 #define TCP_INFR              0x08U /* The flag in Fast Recovery */
@@ -127,6 +128,26 @@
 #define TCP_RTO_MAX 240 /* 120s,The unit is half a second */
 #define TCP_RTO_MIN 1   /* 0.5s */
 
+#ifdef CONFIG_NET_TCP_CC
+/* Increments a size inc and holds at max value rather than rollover. */
+
+#define CC_CWND_INC(wnd, inc) \
+ do { \
+  if ((uint32_t)((wnd) + (inc)) >= (wnd)) \
+    { \
+      (wnd) = (uint32_t)((wnd) + (inc)); \
+    } \
+  else \
+    { \
+      (wnd) = (uint32_t)-1; \
+    } \
+ } while(0)
+
+/* The length of the bandwidth filter of BBR, in round trips */
+
+#define TCP_BBR_BW_RTTS 10
+#endif
+
 /****************************************************************************
  * Public Type Definitions
  ****************************************************************************/
@@ -149,6 +170,76 @@ struct net_driver_s;      /* Forward reference */
 struct devif_callback_s;  /* Forward reference */
 struct tcp_backlog_s;     /* Forward reference */
 struct tcp_hdr_s;         /* Forward reference */
+struct tcp_conn_s;        /* Forward reference */
+
+#ifdef CONFIG_NET_TCP_CC
+/* A congestion control algorithm.  The common part of the congestion
+ * control in tcp_cc.c detects the duplicate ACKs, runs the fast
+ * retransmit and fast recovery and resets cwnd on a retransmission
+ * timeout, the algorithm decides how cwnd grows and how much it shrinks.
+ */
+
+struct tcp_cc_ops_s
+{
+  FAR const char *name;
+
+  /* Reset the private state of the algorithm, may be NULL */
+
+  CODE void (*init)(FAR struct tcp_conn_s *conn);
+
+  /* Called for each ACK of new data, also in fast recovery, may be NULL */
+
+  CODE void (*acked)(FAR struct tcp_conn_s *conn, uint32_t acked);
+
+  /* Grow cwnd on an ACK of new data outside of fast recovery */
+
+  CODE void (*cong_avoid)(FAR struct tcp_conn_s *conn, uint32_t acked);
+
+  /* Return the slow start threshold to use after a loss */
+
+  CODE uint32_t (*ssthresh)(FAR struct tcp_conn_s *conn);
+};
+
+#ifdef CONFIG_NET_TCP_CC_CUBIC
+/* The private state of CUBIC */
+
+struct tcp_cubic_s
+{
+  clock_t  epoch;         /* Start of the congestion avoidance epoch, 0 if
+                           * it has not started yet */
+  uint32_t k;             /* Time from the epoch to reach w_max (msec) */
+  uint32_t w_max;         /* cwnd before the last reduction */
+  uint32_t w_est;         /* The cwnd a Reno flow would have */
+  uint32_t ack_cnt;       /* Bytes acknowledged towards the next increase
+                           * of cwnd */
+  uint32_t est_acked;     /* Bytes acknowledged towards the next increase
+                           * of w_est */
+};
+#endif
+
+#ifdef CONFIG_NET_TCP_CC_BBR
+/* The private state of BBR */
+
+struct tcp_bbr_s
+{
+  uint8_t  mode;          /* STARTUP, DRAIN, PROBE_BW or PROBE_RTT */
+  uint8_t  cycle;         /* Index in the gain cycle of PROBE_BW */
+  uint8_t  full_cnt;      /* Rounds without bandwidth growth in STARTUP */
+  bool     full_bw;       /* The bottleneck bandwidth has been reached */
+  uint32_t bw[TCP_BBR_BW_RTTS]; /* Delivery rate of the last round trips
+                                 * (bytes/sec) */
+  uint32_t full_bw_max;   /* The bandwidth when full_cnt was reset */
+  uint32_t round_count;   /* The number of round trips so far */
+  uint32_t round_seq;     /* sndseq when the current round trip started */
+  uint32_t delivered;     /* Bytes delivered since the round trip started */
+  clock_t  round_stamp;   /* When the current round trip started */
+  clock_t  min_rtt;       /* Minimum round-trip time (ticks) */
+  clock_t  min_rtt_stamp; /* When min_rtt was sampled */
+  clock_t  mode_stamp;    /* When the current mode or gain phase began */
+  uint32_t prior_cwnd;    /* cwnd before PROBE_RTT */
+};
+#endif
+#endif /* CONFIG_NET_TCP_CC */
 
 /* This is a container that holds the poll-related information */
 
@@ -208,6 +299,13 @@ struct tcp_conn_s
 
   /* TCP-specific content follows */
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  hash_node_t hnode;      /* Entry in the table keyed by remote address
+                           * and both ports */
+  hash_node_t pnode;      /* Entry in the table keyed by local port */
+  hash_node_t lnode;      /* Entry in the table of listeners */
+#endif
+
   union ip_binding_u u;   /* IP address binding */
   uint8_t  rcvseq[4];     /* The sequence number that we expect to
                            * receive next */
@@ -244,7 +342,7 @@ struct tcp_conn_s
                            * connection */
 #endif
   uint32_t rcv_adv;       /* The right edge of the recv window advertised */
-#ifdef CONFIG_NET_TCP_CC_NEWRENO
+#ifdef CONFIG_NET_TCP_CC
   uint32_t last_ackno;    /* The ack number at the last receive ack */
   uint32_t dupacks;       /* The number of duplicate ack */
   uint32_t fr_recover;    /* The snd_seq at the retransmissions */
@@ -252,6 +350,20 @@ struct tcp_conn_s
   uint32_t cwnd;          /* The Congestion window */
   uint32_t max_cwnd;      /* The Congestion window maximum value */
   uint32_t ssthresh;      /* The Slow start threshold */
+
+  /* The congestion control algorithm and its private state */
+
+  FAR const struct tcp_cc_ops_s *cc_ops;
+  union
+  {
+#ifdef CONFIG_NET_TCP_CC_CUBIC
+    struct tcp_cubic_s cubic;
+#endif
+#ifdef CONFIG_NET_TCP_CC_BBR
+    struct tcp_bbr_s bbr;
+#endif
+    uint8_t dummy;
+  } cc_priv;
 #endif
 #ifdef CONFIG_NET_TCP_WINDOW_SCALE
   uint32_t snd_wnd;       /* Sequence and acknowledgement numbers of last
@@ -411,7 +523,7 @@ struct tcp_wrbuffer_s
   uint16_t   wb_sent;      /* Number of bytes sent from the I/O buffer chain */
   uint8_t    wb_nrtx;      /* The number of retransmissions for the last
                             * segment sent */
-#if defined(CONFIG_NET_TCP_FAST_RETRANSMIT) && !defined(CONFIG_NET_TCP_CC_NEWRENO)
+#if defined(CONFIG_NET_TCP_FAST_RETRANSMIT) && !defined(CONFIG_NET_TCP_CC)
   uint8_t    wb_nack;      /* The number of ack count */
 #endif
   struct iob_s *wb_iob;    /* Head of the I/O buffer chain */
@@ -455,6 +567,18 @@ extern "C"
 {
 #endif
 
+/* The congestion control algorithms */
+
+#ifdef CONFIG_NET_TCP_CC_NEWRENO
+extern const struct tcp_cc_ops_s g_tcp_cc_newreno;
+#endif
+#ifdef CONFIG_NET_TCP_CC_CUBIC
+extern const struct tcp_cc_ops_s g_tcp_cc_cubic;
+#endif
+#ifdef CONFIG_NET_TCP_CC_BBR
+extern const struct tcp_cc_ops_s g_tcp_cc_bbr;
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -2251,7 +2375,8 @@ bool tcp_reorder_ofosegs(int nofosegs, FAR struct tcp_ofoseg_s *ofosegs);
  *
  * Description:
  *   Initialize the congestion control variables, cwnd, ssthresh and dupacks.
- *   The function is called on starting a new connection.
+ *   The function is called on starting a new connection.  The connection
+ *   uses the default algorithm if none was selected with TCP_CONGESTION.
  *
  * Input Parameters:
  *   conn   - The TCP connection of interest
@@ -2265,7 +2390,7 @@ bool tcp_reorder_ofosegs(int nofosegs, FAR struct tcp_ofoseg_s *ofosegs);
  *
  ****************************************************************************/
 
-#ifdef CONFIG_NET_TCP_CC_NEWRENO
+#ifdef CONFIG_NET_TCP_CC
 void tcp_cc_init(FAR struct tcp_conn_s *conn);
 
 /****************************************************************************
@@ -2308,6 +2433,54 @@ void tcp_cc_update(FAR struct tcp_conn_s *conn, FAR struct tcp_hdr_s *tcp);
  ****************************************************************************/
 
 void tcp_cc_recv_ack(FAR struct tcp_conn_s *conn, FAR struct tcp_hdr_s *tcp);
+
+/****************************************************************************
+ * Name: tcp_cc_timeout
+ *
+ * Description:
+ *   Update the congestion control variables when the retransmission timer
+ *   expires: cwnd restarts from one segment in slow start.
+ *
+ * Input Parameters:
+ *   conn   - The TCP connection of interest
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+void tcp_cc_timeout(FAR struct tcp_conn_s *conn);
+
+/****************************************************************************
+ * Name: tcp_cc_setname
+ *
+ * Description:
+ *   Select the congestion control algorithm of a connection by name, this
+ *   implements the TCP_CONGESTION socket option.
+ *
+ * Input Parameters:
+ *   conn   - The TCP connection of interest
+ *   name   - The name of the algorithm, such as "cubic"
+ *
+ * Returned Value:
+ *   Zero (OK) on success, -ENOENT if no such algorithm is enabled.
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+int tcp_cc_setname(FAR struct tcp_conn_s *conn, FAR const char *name);
+
+/****************************************************************************
+ * Name: tcp_cc_getname
+ *
+ * Description:
+ *   Return the name of the congestion control algorithm of a connection.
+ *
+ ****************************************************************************/
+
+FAR const char *tcp_cc_getname(FAR struct tcp_conn_s *conn);
 #endif
 
 #ifdef __cplusplus
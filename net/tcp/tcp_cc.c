@@ -24,7 +24,12 @@
  * Included Files
  ****************************************************************************/
 
+#include <nuttx/config.h>
+
 #include <debug.h>
+#include <errno.h>
+#include <string.h>
+#include <sys/param.h>
 
 #include "tcp/tcp.h"
 
@@ -60,24 +65,31 @@
     } \
  } while(0)
 
-/* Increments a size inc and holds at max value rather than rollover. */
-
-#define CC_CWND_INC(wnd, inc) \
- do { \
-  if ((uint32_t)((wnd) + (inc)) >= (wnd)) \
-    { \
-      (wnd) = (uint32_t)((wnd) + (inc)); \
-    } \
-  else \
-    { \
-      (wnd) = (uint32_t)-1; \
-    } \
- } while(0)
+#if defined(CONFIG_NET_TCP_CC_DEFAULT_NEWRENO)
+#  define TCP_CC_DEFAULT (&g_tcp_cc_newreno)
+#elif defined(CONFIG_NET_TCP_CC_DEFAULT_CUBIC)
+#  define TCP_CC_DEFAULT (&g_tcp_cc_cubic)
+#else
+#  define TCP_CC_DEFAULT (&g_tcp_cc_bbr)
+#endif
 
 /****************************************************************************
- * Private Functions
+ * Private Data
  ****************************************************************************/
 
+static FAR const struct tcp_cc_ops_s * const g_tcp_cc_algos[] =
+{
+#ifdef CONFIG_NET_TCP_CC_NEWRENO
+  &g_tcp_cc_newreno,
+#endif
+#ifdef CONFIG_NET_TCP_CC_CUBIC
+  &g_tcp_cc_cubic,
+#endif
+#ifdef CONFIG_NET_TCP_CC_BBR
+  &g_tcp_cc_bbr,
+#endif
+};
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -103,6 +115,11 @@
 
 void tcp_cc_init(FAR struct tcp_conn_s *conn)
 {
+  if (conn->cc_ops == NULL)
+    {
+      conn->cc_ops = TCP_CC_DEFAULT;
+    }
+
   CC_INIT_CWND(conn->cwnd, conn->mss);
 
   /* RFC 5681 recommends setting ssthresh arbitrarily high and
@@ -117,6 +134,11 @@ void tcp_cc_init(FAR struct tcp_conn_s *conn)
 
   conn->ssthresh = 2 * TCP_IPV4_DEFAULT_MSS;
   conn->dupacks = 0;
+
+  if (conn->cc_ops->init != NULL)
+    {
+      conn->cc_ops->init(conn);
+    }
 }
 
 /****************************************************************************
@@ -140,15 +162,14 @@ void tcp_cc_init(FAR struct tcp_conn_s *conn)
 
 void tcp_cc_update(FAR struct tcp_conn_s *conn, FAR struct tcp_hdr_s *tcp)
 {
-  /* After Fast retransmitted, set ssthresh to the maximum of
-   * the unacked and the 2*SMSS, and enter to Fast Recovery.
-   * ssthresh = max (FlightSize / 2, 2*SMSS) referring to rfc5681
-   * cwnd=ssthresh + 3*SMSS  referring to rfc5681
+  /* After Fast retransmitted, let the algorithm reduce ssthresh (NewReno
+   * uses max(FlightSize / 2, 2*SMSS) referring to rfc5681), and enter to
+   * Fast Recovery with cwnd=ssthresh + 3*SMSS referring to rfc5681.
    */
 
   if (conn->flags & TCP_INFT)
     {
-      conn->ssthresh = MAX(conn->tx_unacked / 2, 2 * conn->mss);
+      conn->ssthresh = conn->cc_ops->ssthresh(conn);
       conn->cwnd = conn->ssthresh + 3 * conn->mss;
 
       conn->flags &= ~TCP_INFT;
@@ -243,6 +264,11 @@ void tcp_cc_recv_ack(FAR struct tcp_conn_s *conn, FAR struct tcp_hdr_s *tcp)
       conn->dupacks = 0;
       conn->last_ackno = ackno;
 
+      if (conn->cc_ops->acked != NULL)
+        {
+          conn->cc_ops->acked(conn, acked);
+        }
+
       /* When the ackno covers more than the fr_recover, exit the
        * fast recovery. Then, reset the "IN Fast Recovery" flags.
        * Also reset the congestion window to the slow start threshold.
@@ -269,34 +295,94 @@ void tcp_cc_recv_ack(FAR struct tcp_conn_s *conn, FAR struct tcp_hdr_s *tcp)
 
       if (conn->tcpstateflags >= TCP_ESTABLISHED)
         {
-          uint32_t increase;
+          conn->cc_ops->cong_avoid(conn, acked);
+        }
+    }
+}
 
-          if (conn->cwnd < conn->ssthresh)
-            {
-              /* slow start (RFC 5681):
-               * Grow cwnd exponentially by maxseg(smss) per ACK.
-               */
+/****************************************************************************
+ * Name: tcp_cc_timeout
+ *
+ * Description:
+ *   Update the congestion control variables when the retransmission timer
+ *   expires: cwnd restarts from one segment in slow start.
+ *
+ * Input Parameters:
+ *   conn   - The TCP connection of interest
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
 
-              increase = acked > 0 ? MIN(acked, conn->mss) : conn->mss;
+void tcp_cc_timeout(FAR struct tcp_conn_s *conn)
+{
+  /* If conn is TCP_INFR, it should enter to slow start */
 
-              CC_CWND_INC(conn->cwnd, increase);
-              ninfo("update slow start cwnd to %u\n", conn->cwnd);
-            }
-          else
-            {
-              /* cong avoid (RFC 5681):
-               * Grow cwnd linearly by approximately maxseg per RTT using
-               * maxseg^2 / cwnd per ACK as the increment.
-               * If cwnd > maxseg^2, fix the cwnd increment at 1 byte to
-               * avoid capping cwnd.
-               */
+  conn->flags &= ~TCP_INFR;
+
+  /* update the max_cwnd */
+
+  conn->max_cwnd = (conn->max_cwnd + 7 * conn->cwnd) >> 3;
+
+  /* reset cwnd and ssthresh, refers to RFC5861. */
+
+  conn->ssthresh = conn->cc_ops->ssthresh(conn);
+  conn->cwnd = conn->mss;
+}
+
+/****************************************************************************
+ * Name: tcp_cc_setname
+ *
+ * Description:
+ *   Select the congestion control algorithm of a connection by name.
+ *
+ * Input Parameters:
+ *   conn   - The TCP connection of interest
+ *   name   - The name of the algorithm, such as "cubic"
+ *
+ * Returned Value:
+ *   Zero (OK) on success, -ENOENT if no such algorithm is enabled.
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+int tcp_cc_setname(FAR struct tcp_conn_s *conn, FAR const char *name)
+{
+  FAR const struct tcp_cc_ops_s *ops;
+  int i;
 
-              increase = MAX((conn->mss * conn->mss / conn->cwnd), 1);
+  for (i = 0; i < nitems(g_tcp_cc_algos); i++)
+    {
+      ops = g_tcp_cc_algos[i];
+      if (strcmp(ops->name, name) == 0)
+        {
+          /* The window is kept, only the private state starts over */
 
-              CC_CWND_INC(conn->cwnd, increase);
-              conn->cwnd = MIN(conn->cwnd, conn->max_cwnd);
-              ninfo("update congestion avoidance cwnd to %u\n", conn->cwnd);
+          conn->cc_ops = ops;
+          if (ops->init != NULL)
+            {
+              ops->init(conn);
             }
+
+          return OK;
         }
     }
+
+  return -ENOENT;
+}
+
+/****************************************************************************
+ * Name: tcp_cc_getname
+ *
+ * Description:
+ *   Return the name of the congestion control algorithm of a connection.
+ *
+ ****************************************************************************/
+
+FAR const char *tcp_cc_getname(FAR struct tcp_conn_s *conn)
+{
+  return conn->cc_ops != NULL ? conn->cc_ops->name : TCP_CC_DEFAULT->name;
 }
@@ -0,0 +1,351 @@
+/****************************************************************************
+ * net/tcp/tcp_cc_bbr.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <debug.h>
+#include <string.h>
+#include <sys/param.h>
+
+#include <nuttx/clock.h>
+
+#include "tcp/tcp.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The modes of BBR */
+
+#define BBR_STARTUP         0  /* Ramp up to the bottleneck bandwidth */
+#define BBR_DRAIN           1  /* Drain the queue built by STARTUP */
+#define BBR_PROBE_BW        2  /* Cruise, probing for more bandwidth */
+#define BBR_PROBE_RTT       3  /* Drain the queue to sample min_rtt */
+
+/* The gains are fixed point numbers, BBR_UNIT being 1.0 */
+
+#define BBR_UNIT            256
+#define BBR_HIGH_GAIN       739  /* 2 / ln(2), used in STARTUP */
+#define BBR_CWND_GAIN       512  /* 2.0, used in PROBE_BW */
+#define BBR_FULL_BW_THRESH  320  /* 1.25, the growth that STARTUP expects */
+#define BBR_FULL_BW_CNT     3    /* Rounds without growth to leave STARTUP */
+
+#define BBR_MIN_RTT_WIN     SEC2TICK(10)
+#define BBR_PROBE_RTT_TIME  MSEC2TICK(200)
+#define BBR_MIN_CWND(conn)  (4 * (uint32_t)(conn)->mss)
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static void bbr_init(FAR struct tcp_conn_s *conn);
+static void bbr_acked(FAR struct tcp_conn_s *conn, uint32_t acked);
+static void bbr_cong_avoid(FAR struct tcp_conn_s *conn, uint32_t acked);
+static uint32_t bbr_ssthresh(FAR struct tcp_conn_s *conn);
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The pacing gain cycle of PROBE_BW.  There is no pacing in the stack, so
+ * it scales the congestion window instead.
+ */
+
+static const uint16_t g_bbr_cycle_gain[] =
+{
+  BBR_UNIT * 5 / 4, BBR_UNIT * 3 / 4, BBR_UNIT, BBR_UNIT,
+  BBR_UNIT, BBR_UNIT, BBR_UNIT, BBR_UNIT
+};
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+const struct tcp_cc_ops_s g_tcp_cc_bbr =
+{
+  "bbr",                /* name */
+  bbr_init,             /* init */
+  bbr_acked,            /* acked */
+  bbr_cong_avoid,       /* cong_avoid */
+  bbr_ssthresh          /* ssthresh */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: bbr_max_bw
+ *
+ * Description:
+ *   Return the bottleneck bandwidth estimate: the maximum delivery rate of
+ *   the last TCP_BBR_BW_RTTS round trips, in bytes per second.
+ *
+ ****************************************************************************/
+
+static uint32_t bbr_max_bw(FAR struct tcp_bbr_s *bbr)
+{
+  uint32_t bw = 0;
+  int i;
+
+  for (i = 0; i < TCP_BBR_BW_RTTS; i++)
+    {
+      bw = MAX(bw, bbr->bw[i]);
+    }
+
+  return bw;
+}
+
+/****************************************************************************
+ * Name: bbr_bdp
+ *
+ * Description:
+ *   Return the bandwidth-delay product scaled by gain, 0 if the model has
+ *   no sample yet.
+ *
+ ****************************************************************************/
+
+static uint32_t bbr_bdp(FAR struct tcp_bbr_s *bbr, uint32_t gain)
+{
+  uint64_t bdp = (uint64_t)bbr_max_bw(bbr) * bbr->min_rtt / TICK_PER_SEC;
+
+  return MIN(bdp * gain / BBR_UNIT, UINT32_MAX);
+}
+
+/****************************************************************************
+ * Name: bbr_check_full_bw
+ *
+ * Description:
+ *   STARTUP has filled the pipe once the bandwidth estimate stopped
+ *   growing by 25% for BBR_FULL_BW_CNT round trips.
+ *
+ ****************************************************************************/
+
+static void bbr_check_full_bw(FAR struct tcp_bbr_s *bbr)
+{
+  uint32_t bw = bbr_max_bw(bbr);
+
+  if (bbr->full_bw)
+    {
+      return;
+    }
+
+  if ((uint64_t)bw * BBR_UNIT >=
+      (uint64_t)bbr->full_bw_max * BBR_FULL_BW_THRESH)
+    {
+      bbr->full_bw_max = bw;
+      bbr->full_cnt    = 0;
+    }
+  else if (++bbr->full_cnt >= BBR_FULL_BW_CNT)
+    {
+      bbr->full_bw = true;
+    }
+}
+
+/****************************************************************************
+ * Name: bbr_update_mode
+ *
+ * Description:
+ *   Run the state machine of BBR.
+ *
+ ****************************************************************************/
+
+static void bbr_update_mode(FAR struct tcp_conn_s *conn, clock_t now)
+{
+  FAR struct tcp_bbr_s *bbr = &conn->cc_priv.bbr;
+
+  switch (bbr->mode)
+    {
+      case BBR_STARTUP:
+        if (bbr->full_bw)
+          {
+            bbr->mode       = BBR_DRAIN;
+            bbr->mode_stamp = now;
+          }
+        break;
+
+      case BBR_DRAIN:
+        if (conn->tx_unacked <= bbr_bdp(bbr, BBR_UNIT))
+          {
+            bbr->mode       = BBR_PROBE_BW;
+            bbr->cycle      = 2;
+            bbr->mode_stamp = now;
+          }
+        break;
+
+      case BBR_PROBE_BW:
+
+        /* Move to the next gain of the cycle every min_rtt */
+
+        if (now - bbr->mode_stamp > bbr->min_rtt)
+          {
+            bbr->cycle      = (bbr->cycle + 1) % nitems(g_bbr_cycle_gain);
+            bbr->mode_stamp = now;
+          }
+        break;
+
+      case BBR_PROBE_RTT:
+        if (now - bbr->mode_stamp > BBR_PROBE_RTT_TIME)
+          {
+            bbr->min_rtt_stamp = now;
+            bbr->mode          = bbr->full_bw ? BBR_PROBE_BW : BBR_STARTUP;
+            bbr->mode_stamp    = now;
+            conn->cwnd         = MAX(conn->cwnd, bbr->prior_cwnd);
+          }
+        return;
+    }
+
+  /* Drain the queue now and then so that min_rtt is not inflated by it */
+
+  if (bbr->min_rtt != 0 && now - bbr->min_rtt_stamp > BBR_MIN_RTT_WIN)
+    {
+      bbr->mode       = BBR_PROBE_RTT;
+      bbr->mode_stamp = now;
+      bbr->prior_cwnd = conn->cwnd;
+    }
+}
+
+/****************************************************************************
+ * Name: bbr_init
+ ****************************************************************************/
+
+static void bbr_init(FAR struct tcp_conn_s *conn)
+{
+  memset(&conn->cc_priv.bbr, 0, sizeof(struct tcp_bbr_s));
+  conn->cc_priv.bbr.mode = BBR_STARTUP;
+}
+
+/****************************************************************************
+ * Name: bbr_acked
+ *
+ * Description:
+ *   Update the model.  A round trip ends when the data sent when it began
+ *   is acknowledged: its duration is a sample of the round-trip time and
+ *   the data acknowledged during it gives the delivery rate.
+ *
+ ****************************************************************************/
+
+static void bbr_acked(FAR struct tcp_conn_s *conn, uint32_t acked)
+{
+  FAR struct tcp_bbr_s *bbr = &conn->cc_priv.bbr;
+  clock_t now = clock_systime_ticks();
+  clock_t rtt;
+
+  bbr->delivered += acked;
+  if (bbr->round_stamp != 0 &&
+      TCP_SEQ_LT(conn->last_ackno, bbr->round_seq))
+    {
+      return;
+    }
+
+  if (bbr->round_stamp != 0)
+    {
+      /* A round trip shorter than a tick is accounted as one tick */
+
+      rtt = MAX(now - bbr->round_stamp, 1);
+      bbr->bw[bbr->round_count++ % TCP_BBR_BW_RTTS] =
+        MIN((uint64_t)bbr->delivered * TICK_PER_SEC / rtt, UINT32_MAX);
+
+      if (bbr->min_rtt == 0 || rtt <= bbr->min_rtt ||
+          now - bbr->min_rtt_stamp > BBR_MIN_RTT_WIN)
+        {
+          bbr->min_rtt       = rtt;
+          bbr->min_rtt_stamp = now;
+        }
+
+      bbr_check_full_bw(bbr);
+    }
+
+  bbr->round_seq   = tcp_getsequence(conn->sndseq);
+  bbr->round_stamp = now != 0 ? now : 1;
+  bbr->delivered   = 0;
+}
+
+/****************************************************************************
+ * Name: bbr_cong_avoid
+ *
+ * Description:
+ *   Steer cwnd towards the bandwidth-delay product times the gain of the
+ *   current mode.  Until the model has a sample, grow like slow start.
+ *
+ ****************************************************************************/
+
+static void bbr_cong_avoid(FAR struct tcp_conn_s *conn, uint32_t acked)
+{
+  FAR struct tcp_bbr_s *bbr = &conn->cc_priv.bbr;
+  uint32_t target;
+
+  bbr_update_mode(conn, clock_systime_ticks());
+
+  switch (bbr->mode)
+    {
+      case BBR_STARTUP:
+        target = bbr_bdp(bbr, BBR_HIGH_GAIN);
+        break;
+
+      case BBR_DRAIN:
+        target = bbr_bdp(bbr, BBR_UNIT);
+        break;
+
+      case BBR_PROBE_BW:
+        target = bbr_bdp(bbr, BBR_CWND_GAIN *
+                              g_bbr_cycle_gain[bbr->cycle] / BBR_UNIT);
+        break;
+
+      default:
+        conn->cwnd = BBR_MIN_CWND(conn);
+        return;
+    }
+
+  target = MAX(target, BBR_MIN_CWND(conn));
+  if (bbr->full_bw)
+    {
+      /* Converge to the target, growing by no more than what is acked */
+
+      CC_CWND_INC(conn->cwnd, acked);
+      conn->cwnd = MIN(conn->cwnd, target);
+    }
+  else if (conn->cwnd < target || bbr->min_rtt == 0)
+    {
+      CC_CWND_INC(conn->cwnd, acked);
+    }
+
+  ninfo("update bbr mode %u cwnd to %u\n", bbr->mode, conn->cwnd);
+}
+
+/****************************************************************************
+ * Name: bbr_ssthresh
+ *
+ * Description:
+ *   BBR does not take losses as a congestion signal, cwnd is restored
+ *   when the recovery ends.
+ *
+ ****************************************************************************/
+
+static uint32_t bbr_ssthresh(FAR struct tcp_conn_s *conn)
+{
+  return MAX(conn->cwnd, BBR_MIN_CWND(conn));
+}
@@ -0,0 +1,267 @@
+/****************************************************************************
+ * net/tcp/tcp_cc_cubic.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <debug.h>
+#include <string.h>
+#include <sys/param.h>
+
+#include <nuttx/clock.h>
+
+#include "tcp/tcp.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* RFC 9438 constants: beta_cubic = 0.7 and C = 0.4 segments/sec^3.  With
+ * the time in msec, C * t^3 is 2 * t^3 / 5000000000 segments, and K^3 is
+ * (W_max - cwnd) * 2500000000 msec^3 with the windows in segments.
+ */
+
+#define CUBIC_BETA(w)      ((uint64_t)(w) * 7 / 10)
+#define CUBIC_C_DIV        5000000000ull
+#define CUBIC_K3_SCALE     2500000000ull
+
+/* (1 + beta_cubic) / 2 for fast convergence */
+
+#define CUBIC_CONVERGE(w)  ((uint64_t)(w) * 17 / 20)
+
+/* alpha_cubic = 3 * (1 - beta_cubic) / (1 + beta_cubic) = 9 / 17 */
+
+#define CUBIC_ALPHA(mss)   ((mss) * 9 / 17)
+
+/* Limit of |t - K| so that C * (t - K)^3 in bytes fits in 64 bits */
+
+#define CUBIC_MAX_DELTA    40000
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static void cubic_init(FAR struct tcp_conn_s *conn);
+static void cubic_cong_avoid(FAR struct tcp_conn_s *conn, uint32_t acked);
+static uint32_t cubic_ssthresh(FAR struct tcp_conn_s *conn);
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+const struct tcp_cc_ops_s g_tcp_cc_cubic =
+{
+  "cubic",              /* name */
+  cubic_init,           /* init */
+  NULL,                 /* acked */
+  cubic_cong_avoid,     /* cong_avoid */
+  cubic_ssthresh        /* ssthresh */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: cubic_cbrt
+ *
+ * Description:
+ *   Integer cube root, rounded down.
+ *
+ ****************************************************************************/
+
+static uint32_t cubic_cbrt(uint64_t x)
+{
+  uint64_t y = 0;
+  uint64_t b;
+  int s;
+
+  for (s = 63; s >= 0; s -= 3)
+    {
+      y <<= 1;
+      b = 3 * y * (y + 1) + 1;
+      if ((x >> s) >= b)
+        {
+          x -= b << s;
+          y++;
+        }
+    }
+
+  return (uint32_t)y;
+}
+
+/****************************************************************************
+ * Name: cubic_target
+ *
+ * Description:
+ *   Return W_cubic(t) = C * (t - K)^3 + W_max in bytes, t being the time
+ *   since the start of the epoch.
+ *
+ ****************************************************************************/
+
+static uint32_t cubic_target(FAR struct tcp_conn_s *conn, clock_t now)
+{
+  FAR struct tcp_cubic_s *cubic = &conn->cc_priv.cubic;
+  int64_t delta = (int64_t)TICK2MSEC(now - cubic->epoch) - cubic->k;
+  uint64_t offs;
+
+  delta = MIN(MAX(delta, -CUBIC_MAX_DELTA), CUBIC_MAX_DELTA);
+  offs  = (uint64_t)(delta < 0 ? -delta : delta);
+  offs  = 2 * offs * offs * offs * conn->mss / CUBIC_C_DIV;
+
+  if (delta < 0)
+    {
+      return offs < cubic->w_max ? cubic->w_max - offs : 0;
+    }
+
+  return MIN(cubic->w_max + offs, UINT32_MAX);
+}
+
+/****************************************************************************
+ * Name: cubic_init
+ ****************************************************************************/
+
+static void cubic_init(FAR struct tcp_conn_s *conn)
+{
+  memset(&conn->cc_priv.cubic, 0, sizeof(struct tcp_cubic_s));
+}
+
+/****************************************************************************
+ * Name: cubic_cong_avoid
+ *
+ * Description:
+ *   Grow cwnd like NewReno in slow start.  In congestion avoidance, grow
+ *   it towards the cubic function of the time since the last reduction,
+ *   or towards the window of a Reno flow if that is larger.
+ *
+ ****************************************************************************/
+
+static void cubic_cong_avoid(FAR struct tcp_conn_s *conn, uint32_t acked)
+{
+  FAR struct tcp_cubic_s *cubic = &conn->cc_priv.cubic;
+  clock_t now = clock_systime_ticks();
+  uint64_t cnt;
+  uint32_t target;
+
+  if (conn->cwnd < conn->ssthresh)
+    {
+      CC_CWND_INC(conn->cwnd, MIN(acked, conn->mss));
+      ninfo("update slow start cwnd to %u\n", conn->cwnd);
+      return;
+    }
+
+  /* Do not grow a window which the sender does not fill */
+
+  if (conn->tx_unacked < conn->cwnd / 2)
+    {
+      return;
+    }
+
+  if (cubic->epoch == 0)
+    {
+      cubic->epoch     = now != 0 ? now : 1;
+      cubic->ack_cnt   = 0;
+      cubic->est_acked = 0;
+      cubic->w_est     = conn->cwnd;
+
+      if (cubic->w_max <= conn->cwnd)
+        {
+          cubic->k     = 0;
+          cubic->w_max = conn->cwnd;
+        }
+      else
+        {
+          cubic->k = cubic_cbrt((uint64_t)(cubic->w_max - conn->cwnd) /
+                                conn->mss * CUBIC_K3_SCALE);
+        }
+    }
+
+  /* Never grow by more than half of cwnd in one round trip */
+
+  target = MIN(cubic_target(conn, now), conn->cwnd + conn->cwnd / 2);
+
+  /* cnt is the number of bytes to acknowledge per segment of growth */
+
+  if (target > conn->cwnd)
+    {
+      cnt = (uint64_t)conn->cwnd * conn->mss / (target - conn->cwnd);
+    }
+  else
+    {
+      cnt = 100 * (uint64_t)conn->cwnd;
+    }
+
+  /* The Reno-friendly region: w_est grows by alpha segments per window */
+
+  cubic->est_acked += acked;
+  while (cubic->est_acked >= cubic->w_est)
+    {
+      cubic->est_acked -= cubic->w_est;
+      cubic->w_est     += CUBIC_ALPHA(conn->mss);
+    }
+
+  if (cubic->w_est > conn->cwnd)
+    {
+      cnt = MIN(cnt, (uint64_t)conn->cwnd * conn->mss /
+                     (cubic->w_est - conn->cwnd));
+    }
+
+  cnt = MAX(cnt, 1);
+  cubic->ack_cnt += acked;
+  if (cubic->ack_cnt >= cnt)
+    {
+      CC_CWND_INC(conn->cwnd, cubic->ack_cnt / cnt * conn->mss);
+      cubic->ack_cnt %= cnt;
+    }
+
+  ninfo("update congestion avoidance cwnd to %u\n", conn->cwnd);
+}
+
+/****************************************************************************
+ * Name: cubic_ssthresh
+ *
+ * Description:
+ *   Remember the window where the loss happened, reduced further if it is
+ *   below the previous one (fast convergence), and reduce cwnd by
+ *   beta_cubic.
+ *
+ ****************************************************************************/
+
+static uint32_t cubic_ssthresh(FAR struct tcp_conn_s *conn)
+{
+  FAR struct tcp_cubic_s *cubic = &conn->cc_priv.cubic;
+
+  cubic->epoch = 0;
+  if (conn->cwnd < cubic->w_max)
+    {
+      cubic->w_max = CUBIC_CONVERGE(conn->cwnd);
+    }
+  else
+    {
+      cubic->w_max = conn->cwnd;
+    }
+
+  return MAX(CUBIC_BETA(conn->cwnd), 2 * conn->mss);
+}
@@ -95,10 +95,194 @@ NET_BUFPOOL_DECLARE(g_tcp_connections, sizeof(struct tcp_conn_s),
 
 static dq_queue_t g_active_tcp_connections;
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+/* The connected TCP connections indexed by remote address and ports, and
+ * by local port.
+ */
+
+static DECLARE_HASHTABLE(g_tcp_conn_hash, CONFIG_NET_TCP_HASH_BITS);
+static DECLARE_HASHTABLE(g_tcp_port_hash, CONFIG_NET_TCP_HASH_BITS);
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: tcp_ipv4_hashkey and tcp_ipv6_hashkey
+ *
+ * Description:
+ *   Create the hash key of a connection from its remote address and ports.
+ *   The local address is left out because a connection bound to
+ *   INADDR_ANY matches any destination address.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_IPv4
+static inline uint32_t tcp_ipv4_hashkey(in_addr_t raddr, uint16_t lport,
+                                        uint16_t rport)
+{
+  return NTOHL(raddr) ^ ((uint32_t)rport << 16) ^ lport;
+}
+#endif /* CONFIG_NET_IPv4 */
+
+#ifdef CONFIG_NET_IPv6
+static inline uint32_t tcp_ipv6_hashkey(FAR const uint16_t *raddr,
+                                        uint16_t lport, uint16_t rport)
+{
+  return ((uint32_t)raddr[4] << 16 | raddr[5]) ^
+         ((uint32_t)raddr[6] << 16 | raddr[7]) ^
+         ((uint32_t)rport << 16) ^ lport;
+}
+#endif /* CONFIG_NET_IPv6 */
+
+/****************************************************************************
+ * Name: tcp_hashkey
+ *
+ * Description:
+ *   Return the hash key of a connection whose addresses and ports are set.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_CONN_HASH
+static uint32_t tcp_hashkey(FAR struct tcp_conn_s *conn)
+{
+#ifdef CONFIG_NET_IPv4
+#ifdef CONFIG_NET_IPv6
+  if (conn->domain == PF_INET)
+#endif
+    {
+      return tcp_ipv4_hashkey(conn->u.ipv4.raddr, conn->lport,
+                              conn->rport);
+    }
+#endif /* CONFIG_NET_IPv4 */
+
+#ifdef CONFIG_NET_IPv6
+#ifdef CONFIG_NET_IPv4
+  else
+#endif
+    {
+      return tcp_ipv6_hashkey(conn->u.ipv6.raddr, conn->lport,
+                              conn->rport);
+    }
+#endif /* CONFIG_NET_IPv6 */
+}
+#endif /* CONFIG_NET_TCP_CONN_HASH */
+
+/****************************************************************************
+ * Name: tcp_nextport
+ *
+ * Description:
+ *   Traverse the TCP connections that may use a local port: the active
+ *   connections that hash the same as the port if the connection hash is
+ *   enabled, all active connections otherwise.  The caller still has to
+ *   compare the port number.
+ *
+ * Assumptions:
+ *   This function is called with the network locked.
+ *
+ ****************************************************************************/
+
+static FAR struct tcp_conn_s *tcp_nextport(FAR struct tcp_conn_s *conn,
+                                           uint16_t portno)
+{
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  FAR hash_node_t *p;
+
+  if (conn == NULL)
+    {
+      p = g_tcp_port_hash[HASH(portno,
+                               hashtable_bits(g_tcp_port_hash))].head;
+    }
+  else
+    {
+      p = conn->pnode.flink;
+    }
+
+  return p != NULL ? container_of(p, struct tcp_conn_s, pnode) : NULL;
+#else
+  UNUSED(portno);
+  return tcp_nextconn(conn);
+#endif
+}
+
+/****************************************************************************
+ * Name: tcp_nextactive
+ *
+ * Description:
+ *   Traverse the active TCP connections that may match a hash key made by
+ *   tcp_ipv4_hashkey() or tcp_ipv6_hashkey(): those that hash the same if
+ *   the connection hash is enabled, all of them otherwise.  The caller
+ *   still has to compare the addresses and ports.
+ *
+ * Assumptions:
+ *   This function is called with the network locked.
+ *
+ ****************************************************************************/
+
+static FAR struct tcp_conn_s *tcp_nextactive(FAR struct tcp_conn_s *conn,
+                                             uint32_t key)
+{
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  FAR hash_node_t *p;
+
+  if (conn == NULL)
+    {
+      p = g_tcp_conn_hash[HASH(key, hashtable_bits(g_tcp_conn_hash))].head;
+    }
+  else
+    {
+      p = conn->hnode.flink;
+    }
+
+  return p != NULL ? container_of(p, struct tcp_conn_s, hnode) : NULL;
+#else
+  UNUSED(key);
+  return tcp_nextconn(conn);
+#endif
+}
+
+/****************************************************************************
+ * Name: tcp_addactive
+ *
+ * Description:
+ *   Put a connection whose addresses and ports are set into the list of
+ *   active connections.
+ *
+ * Assumptions:
+ *   This function is called with the network locked.
+ *
+ ****************************************************************************/
+
+static void tcp_addactive(FAR struct tcp_conn_s *conn)
+{
+  dq_addlast(&conn->sconn.node, &g_active_tcp_connections);
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  hashtable_add(g_tcp_conn_hash, &conn->hnode, tcp_hashkey(conn));
+  hashtable_add(g_tcp_port_hash, &conn->pnode, conn->lport);
+#endif
+}
+
+/****************************************************************************
+ * Name: tcp_remactive
+ *
+ * Description:
+ *   Remove a connection from the list of active connections.
+ *
+ * Assumptions:
+ *   This function is called with the network locked.
+ *
+ ****************************************************************************/
+
+static void tcp_remactive(FAR struct tcp_conn_s *conn)
+{
+  dq_rem(&conn->sconn.node, &g_active_tcp_connections);
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  hashtable_delete(g_tcp_conn_hash, &conn->hnode, tcp_hashkey(conn));
+  hashtable_delete(g_tcp_port_hash, &conn->pnode, conn->lport);
+#endif
+}
+
 /****************************************************************************
  * Name: tcp_listener
  *
@@ -119,7 +303,7 @@ static FAR struct tcp_conn_s *
 
   /* Check if this port number is in use by any active UIP TCP connection */
 
-  while ((conn = tcp_nextconn(conn)) != NULL)
+  while ((conn = tcp_nextport(conn, portno)) != NULL)
     {
       /* Check if this connection is open and the local port assignment
        * matches the requested port number.
@@ -191,15 +375,16 @@ static inline FAR struct tcp_conn_s *
   tcp_ipv4_active(FAR struct net_driver_s *dev, FAR struct tcp_hdr_s *tcp)
 {
   FAR struct ipv4_hdr_s *ip = IPv4BUF;
-  FAR struct tcp_conn_s *conn;
+  FAR struct tcp_conn_s *conn = NULL;
   in_addr_t srcipaddr;
   in_addr_t destipaddr;
+  uint32_t key;
 
-  conn       = (FAR struct tcp_conn_s *)g_active_tcp_connections.head;
   srcipaddr  = net_ip4addr_conv32(ip->srcipaddr);
   destipaddr = net_ip4addr_conv32(ip->destipaddr);
+  key        = tcp_ipv4_hashkey(srcipaddr, tcp->destport, tcp->srcport);
 
-  while (conn)
+  while ((conn = tcp_nextactive(conn, key)) != NULL)
     {
       /* Find an open connection matching the TCP input. The following
        * checks are performed:
@@ -219,25 +404,22 @@ static inline FAR struct tcp_conn_s *
        */
 
       if (conn->tcpstateflags != TCP_CLOSED &&
+#ifdef CONFIG_NET_IPv6
+          conn->domain == PF_INET &&
+#endif
           tcp->destport == conn->lport &&
           tcp->srcport  == conn->rport &&
           (net_ipv4addr_cmp(conn->u.ipv4.laddr, INADDR_ANY) ||
            net_ipv4addr_cmp(destipaddr, conn->u.ipv4.laddr)) &&
           net_ipv4addr_cmp(srcipaddr, conn->u.ipv4.raddr))
         {
-          /* Matching connection found.. break out of the loop and return a
-           * reference to it.
-           */
+          /* Matching connection found.. return a reference to it. */
 
-          break;
+          return conn;
         }
-
-      /* Look at the next active connection */
-
-      conn = (FAR struct tcp_conn_s *)conn->sconn.node.flink;
     }
 
-  return conn;
+  return NULL;
 }
 #endif /* CONFIG_NET_IPv4 */
 
@@ -258,15 +440,16 @@ static inline FAR struct tcp_conn_s *
   tcp_ipv6_active(FAR struct net_driver_s *dev, FAR struct tcp_hdr_s *tcp)
 {
   FAR struct ipv6_hdr_s *ip = IPv6BUF;
-  FAR struct tcp_conn_s *conn;
+  FAR struct tcp_conn_s *conn = NULL;
   net_ipv6addr_t *srcipaddr;
   net_ipv6addr_t *destipaddr;
+  uint32_t key;
 
-  conn       = (FAR struct tcp_conn_s *)g_active_tcp_connections.head;
   srcipaddr  = (net_ipv6addr_t *)ip->srcipaddr;
   destipaddr = (net_ipv6addr_t *)ip->destipaddr;
+  key        = tcp_ipv6_hashkey(*srcipaddr, tcp->destport, tcp->srcport);
 
-  while (conn)
+  while ((conn = tcp_nextactive(conn, key)) != NULL)
     {
       /* Find an open connection matching the TCP input. The following
        * checks are performed:
@@ -286,25 +469,22 @@ static inline FAR struct tcp_conn_s *
        */
 
       if (conn->tcpstateflags != TCP_CLOSED &&
+#ifdef CONFIG_NET_IPv4
+          conn->domain == PF_INET6 &&
+#endif
           tcp->destport == conn->lport &&
           tcp->srcport  == conn->rport &&
           (net_ipv6addr_cmp(conn->u.ipv6.laddr, g_ipv6_unspecaddr) ||
            net_ipv6addr_cmp(*destipaddr, conn->u.ipv6.laddr)) &&
           net_ipv6addr_cmp(*srcipaddr, conn->u.ipv6.raddr))
         {
-          /* Matching connection found.. break out of the loop and return a
-           * reference to it.
-           */
+          /* Matching connection found.. return a reference to it. */
 
-          break;
+          return conn;
         }
-
-      /* Look at the next active connection */
-
-      conn = (FAR struct tcp_conn_s *)conn->sconn.node.flink;
     }
 
-  return conn;
+  return NULL;
 }
 #endif /* CONFIG_NET_IPv6 */
 
@@ -859,7 +1039,7 @@ void tcp_free(FAR struct tcp_conn_s *conn)
     {
       /* Remove the connection from the active list */
 
-      dq_rem(&conn->sconn.node, &g_active_tcp_connections);
+      tcp_remactive(conn);
     }
 
   tcp_free_rx_buffers(conn);
@@ -1106,6 +1286,9 @@ FAR struct tcp_conn_s *tcp_alloc_accept(FAR struct net_driver_s *dev,
       conn->snd_bufs         = listener->snd_bufs;
 #endif
       conn->mss              = listener->mss;
+#ifdef CONFIG_NET_TCP_CC
+      conn->cc_ops           = listener->cc_ops;
+#endif
 
       /* Fill in the necessary fields for the new connection. */
 
@@ -1130,7 +1313,7 @@ FAR struct tcp_conn_s *tcp_alloc_accept(FAR struct net_driver_s *dev,
       conn->sndseq_max       = 0;
 #endif
 
-#ifdef CONFIG_NET_TCP_CC_NEWRENO
+#ifdef CONFIG_NET_TCP_CC
       /* Initialize the variables of congestion control */
 
       tcp_cc_init(conn);
@@ -1156,7 +1339,7 @@ FAR struct tcp_conn_s *tcp_alloc_accept(FAR struct net_driver_s *dev,
        * Interrupts should already be disabled in this context.
        */
 
-      dq_addlast(&conn->sconn.node, &g_active_tcp_connections);
+      tcp_addactive(conn);
       tcp_update_retrantimer(conn, TCP_RTO);
     }
 
@@ -1448,7 +1631,7 @@ int tcp_connect(FAR struct tcp_conn_s *conn, FAR const struct sockaddr *addr)
   conn->rexmit_seq = tcp_getsequence(conn->sndseq);
 #endif
 
-#ifdef CONFIG_NET_TCP_CC_NEWRENO
+#ifdef CONFIG_NET_TCP_CC
   /* Initialize the variables of congestion control. */
 
   tcp_cc_init(conn);
@@ -1467,7 +1650,7 @@ int tcp_connect(FAR struct tcp_conn_s *conn, FAR const struct sockaddr *addr)
 
   /* And, finally, put the connection structure into the active list. */
 
-  dq_addlast(&conn->sconn.node, &g_active_tcp_connections);
+  tcp_addactive(conn);
   ret = OK;
 
 errout_with_lock:
@@ -27,7 +27,9 @@
 #include <nuttx/config.h>
 
 #include <sys/time.h>
+#include <sys/param.h>
 #include <stdint.h>
+#include <string.h>
 #include <errno.h>
 #include <assert.h>
 #include <debug.h>
@@ -239,6 +241,23 @@ int tcp_getsockopt(FAR struct socket *psock, int option,
           }
         break;
 
+#ifdef CONFIG_NET_TCP_CC
+      case TCP_CONGESTION: /* The congestion control algorithm */
+        if (*value_len == 0)
+          {
+            ret = -EINVAL;
+          }
+        else
+          {
+            FAR const char *name = tcp_cc_getname(conn);
+
+            strlcpy(value, name, *value_len);
+            *value_len = MIN(*value_len, strlen(name) + 1);
+            ret        = OK;
+          }
+        break;
+#endif
+
       default:
         nerr("ERROR: Unrecognized TCP option: %d\n", option);
         ret = -ENOPROTOOPT;
@@ -1203,7 +1203,7 @@ found:
   if ((tcp->flags & TCP_ACK) != 0 &&
       (conn->tcpstateflags & TCP_STATE_MASK) != TCP_SYN_RCVD)
     {
-#ifdef CONFIG_NET_TCP_CC_NEWRENO
+#ifdef CONFIG_NET_TCP_CC
       /* If the packet is ack, update the cc var. */
 
       tcp_cc_recv_ack(conn, tcp);
@@ -1274,7 +1274,7 @@ found:
             tcp_snd_wnd_init(conn, tcp);
             tcp_snd_wnd_update(conn, tcp);
 
-#ifdef CONFIG_NET_TCP_CC_NEWRENO
+#ifdef CONFIG_NET_TCP_CC
             tcp_cc_update(conn, tcp);
 #endif
             flags               = TCP_CONNECTED;
@@ -1326,7 +1326,7 @@ found:
             tcp_snd_wnd_init(conn, tcp);
             tcp_snd_wnd_update(conn, tcp);
 
-#ifdef CONFIG_NET_TCP_CC_NEWRENO
+#ifdef CONFIG_NET_TCP_CC
             tcp_cc_update(conn, tcp);
 #endif
             net_incr32(conn->rcvseq, 1); /* ack SYN */
@@ -61,14 +61,82 @@
  * Private Data
  ****************************************************************************/
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+/* All currently listening connections, indexed by local port.
+ * g_tcp_nlisteners enforces CONFIG_NET_MAX_LISTENPORTS.
+ */
+
+static DECLARE_HASHTABLE(g_tcp_listen_hash, CONFIG_NET_TCP_HASH_BITS);
+static int g_tcp_nlisteners;
+#else
 /* The tcp_listenports list all currently listening ports. */
 
 static FAR struct tcp_conn_s *tcp_listenports[CONFIG_NET_MAX_LISTENPORTS];
+#endif
 
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: tcp_nextlistener
+ *
+ * Description:
+ *   Traverse the listening connections that may use a local port: those
+ *   that hash the same as the port if the connection hash is enabled, all
+ *   listeners otherwise.  The caller still has to compare the port number.
+ *
+ * Assumptions:
+ *   This function is called with the network locked.
+ *
+ ****************************************************************************/
+
+static FAR struct tcp_conn_s *
+tcp_nextlistener(FAR struct tcp_conn_s *conn, uint16_t portno)
+{
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  FAR hash_node_t *p;
+
+  if (conn == NULL)
+    {
+      p = g_tcp_listen_hash[HASH(portno,
+                                 hashtable_bits(g_tcp_listen_hash))].head;
+    }
+  else
+    {
+      p = conn->lnode.flink;
+    }
+
+  return p != NULL ? container_of(p, struct tcp_conn_s, lnode) : NULL;
+#else
+  int ndx = 0;
+
+  UNUSED(portno);
+
+  /* Resume after the slot of the previous listener */
+
+  if (conn != NULL)
+    {
+      while (tcp_listenports[ndx] != conn)
+        {
+          ndx++;
+        }
+
+      ndx++;
+    }
+
+  for (; ndx < CONFIG_NET_MAX_LISTENPORTS; ndx++)
+    {
+      if (tcp_listenports[ndx] != NULL)
+        {
+          return tcp_listenports[ndx];
+        }
+    }
+
+  return NULL;
+#endif
+}
+
 /****************************************************************************
  * Name: tcp_findlistener
  *
@@ -89,21 +157,18 @@ FAR struct tcp_conn_s *tcp_findlistener(FAR union ip_binding_u *uaddr,
                                         uint16_t portno)
 #endif
 {
-  int ndx;
+  FAR struct tcp_conn_s *conn = NULL;
 
-  /* Examine each connection structure in each slot of the listener list */
+  /* Examine each listener that may use this local port number */
 
-  for (ndx = 0; ndx < CONFIG_NET_MAX_LISTENPORTS; ndx++)
+  while ((conn = tcp_nextlistener(conn, portno)) != NULL)
     {
-      /* Is this slot assigned?  If so, does the connection have the same
-       * local port number?
-       */
+      /* Does the connection have the same local port number? */
 
-      FAR struct tcp_conn_s *conn = tcp_listenports[ndx];
 #if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
-      if (conn && conn->lport == portno && conn->domain == domain)
+      if (conn->lport == portno && conn->domain == domain)
 #else
-      if (conn && conn->lport == portno)
+      if (conn->lport == portno)
 #endif
         {
 #ifdef CONFIG_NET_IPv6
@@ -160,10 +225,26 @@ FAR struct tcp_conn_s *tcp_findlistener(FAR union ip_binding_u *uaddr,
 
 int tcp_unlisten(FAR struct tcp_conn_s *conn)
 {
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  FAR hash_node_t *p;
+#else
   int ndx;
+#endif
   int ret = -EINVAL;
 
   net_lock();
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  hashtable_for_every_possible(g_tcp_listen_hash, p, conn->lport)
+    {
+      if (p == &conn->lnode)
+        {
+          hashtable_delete(g_tcp_listen_hash, p, conn->lport);
+          g_tcp_nlisteners--;
+          ret = OK;
+          break;
+        }
+    }
+#else
   for (ndx = 0; ndx < CONFIG_NET_MAX_LISTENPORTS; ndx++)
     {
       if (tcp_listenports[ndx] == conn)
@@ -173,6 +254,7 @@ int tcp_unlisten(FAR struct tcp_conn_s *conn)
           break;
         }
     }
+#endif
 
   net_unlock();
   return ret;
@@ -191,7 +273,9 @@ int tcp_unlisten(FAR struct tcp_conn_s *conn)
 
 int tcp_listen(FAR struct tcp_conn_s *conn)
 {
+#ifndef CONFIG_NET_TCP_CONN_HASH
   int ndx;
+#endif
   int ret;
 
   /* This must be done with network locked because the listener table
@@ -220,6 +304,14 @@ int tcp_listen(FAR struct tcp_conn_s *conn)
 
       ret = -ENOBUFS; /* Assume failure */
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+      if (g_tcp_nlisteners < CONFIG_NET_MAX_LISTENPORTS)
+        {
+          hashtable_add(g_tcp_listen_hash, &conn->lnode, conn->lport);
+          g_tcp_nlisteners++;
+          ret = OK;
+        }
+#else
       /* Search all slots until an available slot is found */
 
       for (ndx = 0; ndx < CONFIG_NET_MAX_LISTENPORTS; ndx++)
@@ -235,6 +327,7 @@ int tcp_listen(FAR struct tcp_conn_s *conn)
               break;
             }
         }
+#endif
     }
 
   net_unlock();
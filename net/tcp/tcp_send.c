@@ -219,6 +219,15 @@ static void tcp_sendcommon(FAR struct net_driver_s *dev,
                         &dev->d_ipaddr, &conn->u.ipv4.raddr,
                         conn->sconn.s_ttl, conn->sconn.s_tos, NULL);
 
+#ifdef CONFIG_NET_TCP_GSO
+      /* Every segment of a super-segment takes its own IP ID */
+
+      if (dev->d_gso_size > 0)
+        {
+          ipv4_reserve_ipid((dev->d_sndlen - 1) / dev->d_gso_size);
+        }
+#endif
+
       /* Calculate TCP checksum. */
 
       tcp->tcpchksum = 0;
@@ -411,6 +411,31 @@ static int parse_sack(FAR struct tcp_conn_s *conn, FAR struct tcp_hdr_s *tcp,
 }
 #endif /* CONFIG_NET_TCP_SELECTIVE_ACK */
 
+/****************************************************************************
+ * Name: tcp_max_sndlen
+ *
+ * Description:
+ *   Return the largest amount of data to send in one packet: the MSS, or
+ *   a multiple of it if the device accepts TCP super-segments.
+ *
+ ****************************************************************************/
+
+static uint32_t tcp_max_sndlen(FAR struct net_driver_s *dev,
+                               FAR struct tcp_conn_s *conn)
+{
+#ifdef CONFIG_NET_TCP_GSO
+  uint32_t hdrsize = tcpip_hdrsize(conn);
+
+  if (dev->d_gso_max > hdrsize + conn->mss)
+    {
+      uint32_t maxlen = dev->d_gso_max - hdrsize;
+      return maxlen - maxlen % conn->mss;
+    }
+#endif
+
+  return conn->mss;
+}
+
 /****************************************************************************
  * Name: psock_send_eventhandler
  *
@@ -590,7 +615,7 @@ static uint16_t psock_send_eventhandler(FAR struct net_driver_s *dev,
             }
           else if (ackno == TCP_WBSEQNO(wrb))
             {
-#ifdef CONFIG_NET_TCP_CC_NEWRENO
+#ifdef CONFIG_NET_TCP_CC
               if (conn->dupacks >= TCP_FAST_RETRANSMISSION_THRESH)
 #else
               /* Duplicate ACK? Retransmit data if need */
@@ -607,7 +632,11 @@ static uint16_t psock_send_eventhandler(FAR struct net_driver_s *dev,
                        * driver to send the message and marked as rexmit
                        */
 
+#ifdef CONFIG_NET_TCP_CC
+                      conn->dupacks = 0;
+#else
                       TCP_WBNACK(wrb) = 0;
+#endif
                       conn->timeout = true;
                       netdev_txnotify_dev(conn->dev);
                       return flags;
@@ -632,7 +661,7 @@ static uint16_t psock_send_eventhandler(FAR struct net_driver_s *dev,
                       /* Do fast retransmit */
 
                       rexmitno = ackno;
-#ifndef CONFIG_NET_TCP_CC_NEWRENO
+#ifndef CONFIG_NET_TCP_CC
                       /* Reset counter */
 
                       TCP_WBNACK(wrb) = 0;
@@ -640,7 +669,7 @@ static uint16_t psock_send_eventhandler(FAR struct net_driver_s *dev,
 #endif
                     }
 
-#ifdef CONFIG_NET_TCP_CC_NEWRENO
+#ifdef CONFIG_NET_TCP_CC
                   conn->dupacks = 0;
 #endif
                 }
@@ -777,7 +806,7 @@ static uint16_t psock_send_eventhandler(FAR struct net_driver_s *dev,
               return flags;
             }
 
-#ifdef CONFIG_NET_TCP_CC_NEWRENO
+#ifdef CONFIG_NET_TCP_CC
           /* After Fast retransmitted, set ssthresh to the maximum of
            * the unacked and the 2*SMSS, and enter to Fast Recovery.
            * ssthresh = max (FlightSize / 2, 2*SMSS) referring to rfc5681
@@ -849,7 +878,7 @@ static uint16_t psock_send_eventhandler(FAR struct net_driver_s *dev,
             }
         }
 
-#ifdef CONFIG_NET_TCP_CC_NEWRENO
+#ifdef CONFIG_NET_TCP_CC
           /* After Fast retransmitted, set ssthresh to the maximum of
            * the unacked and the 2*SMSS, and enter to Fast Recovery.
            * ssthresh = max (FlightSize / 2, 2*SMSS) referring to rfc5681
@@ -1029,7 +1058,7 @@ static uint16_t psock_send_eventhandler(FAR struct net_driver_s *dev,
 
       seq = TCP_WBSEQNO(wrb) + TCP_WBSENT(wrb);
 
-#ifdef CONFIG_NET_TCP_CC_NEWRENO
+#ifdef CONFIG_NET_TCP_CC
       snd_wnd_edge = conn->snd_wl2 + MIN(conn->snd_wnd, conn->cwnd);
 #else
       snd_wnd_edge = conn->snd_wl2 + conn->snd_wnd;
@@ -1040,9 +1069,9 @@ static uint16_t psock_send_eventhandler(FAR struct net_driver_s *dev,
           int ret;
 
           sndlen = TCP_WBPKTLEN(wrb) - TCP_WBSENT(wrb);
-          if (sndlen > conn->mss)
+          if (sndlen > tcp_max_sndlen(dev, conn))
             {
-              sndlen = conn->mss;
+              sndlen = tcp_max_sndlen(dev, conn);
             }
 
           remaining_snd_wnd = TCP_SEQ_SUB(snd_wnd_edge, seq);
@@ -1113,6 +1142,12 @@ static uint16_t psock_send_eventhandler(FAR struct net_driver_s *dev,
               return flags;
             }
 
+#ifdef CONFIG_NET_TCP_GSO
+          /* Let the driver split a super-segment into MSS sized ones */
+
+          dev->d_gso_size = sndlen > conn->mss ? conn->mss : 0;
+#endif
+
           /* Remember how much data we send out now so that we know
            * when everything has been acknowledged.  Just increment
            * the amount of data sent. This will be needed in sequence
@@ -1201,6 +1236,15 @@ static uint32_t tcp_max_wrb_size(FAR struct tcp_conn_s *conn)
 
   size = 4 * mss;
 
+#ifdef CONFIG_NET_TCP_GSO
+  /* or as much as fits in a super-segment */
+
+  if (size < CONFIG_NET_TCP_GSO_MAXSIZE)
+    {
+      size = CONFIG_NET_TCP_GSO_MAXSIZE;
+    }
+#endif
+
   /* but it should not hog too many IOB buffers */
 
   if (size > CONFIG_IOB_NBUFFERS * CONFIG_IOB_BUFSIZE / 2)
@@ -26,8 +26,10 @@
 
 #include <nuttx/config.h>
 
+#include <sys/param.h>
 #include <sys/time.h>
 #include <stdint.h>
+#include <string.h>
 #include <errno.h>
 #include <assert.h>
 #include <debug.h>
@@ -260,6 +262,32 @@ int tcp_setsockopt(FAR struct socket *psock, int option,
           }
         break;
 
+#ifdef CONFIG_NET_TCP_CC
+      case TCP_CONGESTION: /* The congestion control algorithm */
+        if (value_len == 0)
+          {
+            ret = -EINVAL;
+          }
+        else
+          {
+            char name[TCP_CA_NAME_MAX];
+            size_t len;
+
+            /* As on Linux, the name need not be NUL terminated: it ends at
+             * the first NUL or after TCP_CA_NAME_MAX - 1 characters.
+             */
+
+            len = strnlen(value, MIN(value_len, TCP_CA_NAME_MAX - 1));
+            memcpy(name, value, len);
+            name[len] = '\0';
+
+            net_lock();
+            ret = tcp_cc_setname(conn, name);
+            net_unlock();
+          }
+        break;
+#endif
+
       default:
         nerr("ERROR: Unrecognized TCP option: %d\n", option);
         ret = -ENOPROTOOPT;
@@ -97,10 +97,48 @@ static mutex_t g_free_lock = NXMUTEX_INITIALIZER;
 
 static dq_queue_t g_active_udp_connections;
 
+#ifdef CONFIG_NET_UDP_CONN_HASH
+/* The bound UDP connections indexed by local port */
+
+static DECLARE_HASHTABLE(g_udp_port_hash, CONFIG_NET_UDP_HASH_BITS);
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: udp_nextport
+ *
+ * Description:
+ *   Traverse the bound UDP connections that hash the same as a local port.
+ *   The caller still has to compare the port number.
+ *
+ * Assumptions:
+ *   This function must be called with the network locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_UDP_CONN_HASH
+static FAR struct udp_conn_s *udp_nextport(FAR struct udp_conn_s *conn,
+                                           uint16_t portno)
+{
+  FAR hash_node_t *p;
+
+  if (conn == NULL)
+    {
+      p = g_udp_port_hash[HASH(portno,
+                               hashtable_bits(g_udp_port_hash))].head;
+    }
+  else
+    {
+      p = conn->pnode.flink;
+    }
+
+  return p != NULL ? container_of(p, struct udp_conn_s, pnode) : NULL;
+}
+#endif
+
 /****************************************************************************
  * Name: udp_find_conn()
  *
@@ -130,7 +168,11 @@ static FAR struct udp_conn_s *udp_find_conn(uint8_t domain,
 
   /* Now search each connection structure. */
 
+#ifdef CONFIG_NET_UDP_CONN_HASH
+  while ((conn = udp_nextport(conn, portno)) != NULL)
+#else
   while ((conn = udp_nextconn(conn)) != NULL)
+#endif
     {
       /* With SO_REUSEADDR set for both sockets, we do not need to check its
        * address and port.
@@ -203,9 +245,11 @@ udp_ipv4_active(FAR struct net_driver_s *dev, FAR struct udp_conn_s *conn,
 #endif
   FAR struct ipv4_hdr_s *ip = IPv4BUF;
 
-  conn = udp_nextconn(conn);
-
-  while (conn)
+#ifdef CONFIG_NET_UDP_CONN_HASH
+  while ((conn = udp_nextport(conn, udp->destport)) != NULL)
+#else
+  while ((conn = udp_nextconn(conn)) != NULL)
+#endif
     {
       /* If the local UDP port is non-zero, the connection is considered
        * to be used. If so, then the following checks are performed:
@@ -314,10 +358,6 @@ udp_ipv4_active(FAR struct net_driver_s *dev, FAR struct udp_conn_s *conn,
               break;
             }
         }
-
-      /* Look at the next active connection */
-
-      conn = (FAR struct udp_conn_s *)conn->sconn.node.flink;
     }
 
   return conn;
@@ -343,9 +383,11 @@ udp_ipv6_active(FAR struct net_driver_s *dev, FAR struct udp_conn_s *conn,
 {
   FAR struct ipv6_hdr_s *ip = IPv6BUF;
 
-  conn = udp_nextconn(conn);
-
-  while (conn != NULL)
+#ifdef CONFIG_NET_UDP_CONN_HASH
+  while ((conn = udp_nextport(conn, udp->destport)) != NULL)
+#else
+  while ((conn = udp_nextconn(conn)) != NULL)
+#endif
     {
       /* If the local UDP port is non-zero, the connection is considered
        * to be used. If so, then the following checks are performed:
@@ -454,10 +496,6 @@ udp_ipv6_active(FAR struct net_driver_s *dev, FAR struct udp_conn_s *conn,
               break;
             }
         }
-
-      /* Look at the next active connection */
-
-      conn = (FAR struct udp_conn_s *)conn->sconn.node.flink;
     }
 
   return conn;
@@ -538,6 +576,41 @@ errout:
   return portno;
 }
 
+/****************************************************************************
+ * Name: udp_setport
+ *
+ * Description:
+ *   Set the local port number (network byte order) of a connection.  0
+ *   unbinds the connection.
+ *
+ ****************************************************************************/
+
+void udp_setport(FAR struct udp_conn_s *conn, uint16_t portno)
+{
+#ifdef CONFIG_NET_UDP_CONN_HASH
+  /* The table is walked by the input path, so update it with the network
+   * locked.
+   */
+
+  net_lock();
+
+  if (conn->lport != 0)
+    {
+      hashtable_delete(g_udp_port_hash, &conn->pnode, conn->lport);
+    }
+
+  if (portno != 0)
+    {
+      hashtable_add(g_udp_port_hash, &conn->pnode, portno);
+    }
+
+  conn->lport = portno;
+  net_unlock();
+#else
+  conn->lport = portno;
+#endif
+}
+
 /****************************************************************************
  * Name: udp_initialize
  *
@@ -622,8 +695,8 @@ void udp_free(FAR struct udp_conn_s *conn)
 
   DEBUGASSERT(conn->crefs == 0);
 
+  udp_setport(conn, 0);
   nxmutex_lock(&g_free_lock);
-  conn->lport = 0;
 
   /* Remove the connection from the active list */
 
@@ -852,7 +925,7 @@ int udp_bind(FAR struct udp_conn_s *conn, FAR const struct sockaddr *addr)
         }
       else
         {
-          conn->lport = portno;
+          udp_setport(conn, portno);
           ret         = OK;
         }
     }
@@ -877,7 +950,7 @@ int udp_bind(FAR struct udp_conn_s *conn, FAR const struct sockaddr *addr)
         {
           /* No.. then bind the socket to the port */
 
-          conn->lport = portno;
+          udp_setport(conn, portno);
           ret         = OK;
         }
       else
@@ -929,7 +1002,7 @@ int udp_connect(FAR struct udp_conn_s *conn, FAR const struct sockaddr *addr)
        * connection structure.
        */
 
-      conn->lport = HTONS(udp_select_port(conn->domain, &conn->u));
+      udp_setport(conn, HTONS(udp_select_port(conn->domain, &conn->u)));
       if (!conn->lport)
         {
           nerr("ERROR: Failed to get a local port!\n");
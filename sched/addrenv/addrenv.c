@@ -28,10 +28,12 @@
 
 #include <assert.h>
 #include <debug.h>
+#include <errno.h>
 
 #include <nuttx/addrenv.h>
 #include <nuttx/atomic.h>
 #include <nuttx/irq.h>
+#include <nuttx/kmalloc.h>
 #include <nuttx/sched.h>
 #include <nuttx/wqueue.h>
 
@@ -291,6 +293,66 @@ int addrenv_join(FAR struct tcb_s *ptcb, FAR struct tcb_s *tcb)
   return OK;
 }
 
+/****************************************************************************
+ * Name: addrenv_fork
+ *
+ * Description:
+ *   Give a fork()'ed child, that has joined its parent's address
+ *   environment so far, a copy-on-write duplicate of it.
+ *
+ * Input Parameters:
+ *   tcb  - The tcb of the child process.
+ *
+ * Returned Value:
+ *   This is a NuttX internal function so it follows the convention that
+ *   0 (OK) is returned on success and a negated errno is returned on
+ *   failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_ARCH_ADDRENV_COW
+int addrenv_fork(FAR struct tcb_s *tcb)
+{
+  FAR struct addrenv_s *parent = tcb->addrenv_own;
+  FAR struct addrenv_s *addrenv;
+  int ret;
+
+  DEBUGASSERT(parent != NULL && parent == this_task()->addrenv_curr);
+
+  addrenv = addrenv_allocate();
+  if (addrenv == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  ret = up_addrenv_fork(&parent->addrenv, &addrenv->addrenv);
+  if (ret < 0)
+    {
+      berr("ERROR: up_addrenv_fork failed: %d\n", ret);
+      kmm_free(addrenv);
+      return ret;
+    }
+
+  /* The stack of the child was allocated from the parent's heap.  The
+   * child now owns its private copy of it, so the parent's copy can go.
+   */
+
+  if (tcb->stack_alloc_ptr != NULL &&
+      (tcb->flags & TCB_FLAG_FREE_STACK) != 0)
+    {
+      kumm_free(tcb->stack_alloc_ptr);
+    }
+
+  /* Leave the parent's address environment for the new one */
+
+  addrenv_drop(parent, false);
+  tcb->addrenv_own  = addrenv;
+  tcb->addrenv_curr = addrenv;
+
+  return OK;
+}
+#endif
+
 /****************************************************************************
  * Name: addrenv_leave
  *
@@ -57,6 +57,8 @@
 #include "mqueue/msg.h"
 #include "clock/clock.h"
 #include "timer/timer.h"
+#include "wqueue/wqueue.h"
+#include "wdog/wdog.h"
 #include "irq/irq.h"
 #include "group/group.h"
 #include "init/init.h"
@@ -425,6 +427,7 @@ static void idle_task_initialize(void)
       tasklist = TLIST_HEAD(tcb);
 #endif
       dq_addfirst((FAR dq_entry_t *)tcb, tasklist);
+      nxsched_prioindex_insert(tcb, tasklist);
 
       /* Mark the idle task as the running task */
 
@@ -545,6 +548,16 @@ void nx_start(void)
 
   /* Initialize RTOS Data ***************************************************/
 
+  /* Initialize the watchdog timer wheel (if configured) */
+
+  wd_initialize();
+
+#ifdef CONFIG_SCHED_HPWORK_PERCPU
+  /* Initialize the per-CPU high priority work queues */
+
+  work_initialize_highpri();
+#endif
+
   drivers_early_initialize();
 
   sched_trace_begin();
@@ -32,6 +32,7 @@
 #include <debug.h>
 
 #include <nuttx/atomic.h>
+#include <nuttx/pthread.h>
 
 #include "pthread/pthread.h"
 
@@ -40,7 +41,7 @@
  ****************************************************************************/
 
 /****************************************************************************
- * Name: pthread_cond_broadcast
+ * Name: nx_pthread_cond_broadcast
  *
  * Description:
  *    A thread broadcast on a condition variable.
@@ -55,7 +56,7 @@
  *
  ****************************************************************************/
 
-int pthread_cond_broadcast(FAR pthread_cond_t *cond)
+int nx_pthread_cond_broadcast(FAR pthread_cond_t *cond)
 {
   int ret = OK;
 
@@ -31,6 +31,7 @@
 #include <debug.h>
 
 #include <nuttx/atomic.h>
+#include <nuttx/pthread.h>
 
 #include "pthread/pthread.h"
 
@@ -39,7 +40,7 @@
  ****************************************************************************/
 
 /****************************************************************************
- * Name: pthread_cond_signal
+ * Name: nx_pthread_cond_signal
  *
  * Description:
  *    A thread can signal on a condition variable.
@@ -54,7 +55,7 @@
  *
  ****************************************************************************/
 
-int pthread_cond_signal(FAR pthread_cond_t *cond)
+int nx_pthread_cond_signal(FAR pthread_cond_t *cond)
 {
   int ret = OK;
 
@@ -32,6 +32,7 @@
 #include <errno.h>
 
 #include <nuttx/irq.h>
+#include <nuttx/pthread.h>
 #include <nuttx/sched.h>
 #include <nuttx/semaphore.h>
 
@@ -61,6 +62,15 @@ static void pthread_mutex_add(FAR struct pthread_mutex_s *mutex)
   FAR struct tcb_s *rtcb = this_task();
   irqstate_t flags;
 
+#ifdef CONFIG_PTHREAD_FASTPATH
+  /* Mutexes that are locked in user space are never tracked */
+
+  if (pthread_mutex_fastpath(mutex))
+    {
+      return;
+    }
+#endif
+
   DEBUGASSERT(mutex->flink == NULL);
 
   /* Add the mutex to the list of mutexes held by this pthread */
@@ -92,6 +102,13 @@ static void pthread_mutex_remove(FAR struct pthread_mutex_s *mutex)
   FAR struct pthread_mutex_s *prev;
   irqstate_t flags;
 
+#ifdef CONFIG_PTHREAD_FASTPATH
+  if (pthread_mutex_fastpath(mutex))
+    {
+      return;
+    }
+#endif
+
   flags = spin_lock_irqsave(&rtcb->mutex_lock);
 
   /* Remove the mutex from the list of mutexes held by this task */
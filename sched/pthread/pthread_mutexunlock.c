@@ -33,6 +33,8 @@
 #include <errno.h>
 #include <debug.h>
 
+#include <nuttx/pthread.h>
+
 #include "pthread/pthread.h"
 
 /****************************************************************************
@@ -40,7 +42,7 @@
  ****************************************************************************/
 
 /****************************************************************************
- * Name: pthread_mutex_unlock
+ * Name: nx_pthread_mutex_unlock
  *
  * Description:
  *   The pthread_mutex_unlock() function releases the mutex object referenced
@@ -67,7 +69,7 @@
  *
  ****************************************************************************/
 
-int pthread_mutex_unlock(FAR pthread_mutex_t *mutex)
+int nx_pthread_mutex_unlock(FAR pthread_mutex_t *mutex)
 {
   int ret = EPERM;
 
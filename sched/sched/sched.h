@@ -31,6 +31,8 @@
 
 #include <sys/types.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <strings.h>
 #include <sched.h>
 
 #include <nuttx/arch.h>
@@ -132,6 +134,22 @@ struct tasklist_s
   uint8_t attr;          /* List attribute flags */
 };
 
+#ifdef CONFIG_SCHED_PRIORITY_BITMAP
+/* This structure indexes a prioritized ready-to-run list by priority.  The
+ * list itself is unchanged:  TCBs of equal priority still form one
+ * contiguous run in descending priority order.  The index records the last
+ * TCB of each non-empty run and a bitmap of the non-empty priorities so
+ * that the insertion point for a new TCB can be found without walking the
+ * list.
+ */
+
+struct prioindex_s
+{
+  uint32_t bitmap[(SCHED_PRIORITY_MAX + 32) >> 5];
+  FAR struct tcb_s *tail[SCHED_PRIORITY_MAX + 1];
+};
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -189,6 +207,18 @@ extern dq_queue_t g_readytorun;
 extern dq_queue_t g_assignedtasks[CONFIG_SMP_NCPUS];
 #endif
 
+#ifdef CONFIG_SCHED_PRIORITY_BITMAP
+/* Declared in sched_prioindex.c ********************************************/
+
+/* Priority indexes of the g_readytorun and g_assignedtasks[] lists */
+
+extern struct prioindex_s g_readytorun_index;
+
+#ifdef CONFIG_SMP
+extern struct prioindex_s g_assignedtasks_index[CONFIG_SMP_NCPUS];
+#endif
+#endif
+
 /* g_delivertasks is used to record the tcb that needs to be passed to
  * another cpu for scheduling. When it is null, it means that there
  * is no tcb that needs to be processed. When it is not null,
@@ -318,6 +348,19 @@ void nxsched_remove_blocked(FAR struct tcb_s *btcb);
 int  nxsched_set_priority(FAR struct tcb_s *tcb, int sched_priority);
 bool nxsched_reprioritize_rtr(FAR struct tcb_s *tcb, int priority);
 
+/* Priority index of the ready-to-run lists */
+
+#ifdef CONFIG_SCHED_PRIORITY_BITMAP
+void nxsched_prioindex_rebuild(FAR dq_queue_t *list);
+void nxsched_prioindex_update(FAR struct tcb_s *tcb, int sched_priority);
+#else
+#  define nxsched_prioindex_insert(tcb,list)
+#  define nxsched_prioindex_remove(tcb,list)
+#  define nxsched_prioindex_rebuild(list)
+#  define nxsched_prioindex_update(tcb,sched_priority) \
+     ((tcb)->sched_priority = (uint8_t)(sched_priority))
+#endif
+
 /* Priority inheritance support */
 
 #ifdef CONFIG_PRIORITY_INHERITANCE
@@ -354,6 +397,21 @@ uint32_t nxsched_process_sporadic(FAR struct tcb_s *tcb, uint32_t ticks,
 void nxsched_sporadic_lowpriority(FAR struct tcb_s *tcb);
 #endif
 
+#ifdef CONFIG_SCHED_DEADLINE
+#  define nxsched_is_deadline(tcb) \
+     (((tcb)->flags & TCB_FLAG_POLICY_MASK) == TCB_FLAG_SCHED_DEADLINE)
+
+int  nxsched_set_deadline(FAR struct tcb_s *tcb,
+                          FAR const struct sched_param *param);
+void nxsched_get_deadline(FAR struct tcb_s *tcb,
+                          FAR struct sched_param *param);
+void nxsched_stop_deadline(FAR struct tcb_s *tcb);
+void nxsched_wakeup_deadline(FAR struct tcb_s *tcb);
+int  nxsched_yield_deadline(FAR struct tcb_s *tcb);
+uint32_t nxsched_process_deadline(FAR struct tcb_s *tcb, uint32_t ticks,
+                                  bool noswitches);
+#endif
+
 #ifdef CONFIG_SIG_SIGSTOP_ACTION
 void nxsched_suspend(FAR struct tcb_s *tcb);
 #endif
@@ -395,6 +453,19 @@ void nxsched_process_delivered(int cpu);
 
 #define nxsched_islocked_tcb(tcb)   ((tcb)->lockcount > 0)
 
+/* Per-CPU run queue balancing */
+
+#ifdef CONFIG_SCHED_PERCPU_RUNQUEUE
+FAR struct tcb_s *nxsched_steal_task(int cpu, int minprio);
+#endif
+
+#if defined(CONFIG_SCHED_PERCPU_BALANCE_INTERVAL) && \
+    CONFIG_SCHED_PERCPU_BALANCE_INTERVAL > 0
+void nxsched_process_balance(void);
+#else
+#  define nxsched_process_balance()
+#endif
+
 /* CPU load measurement support */
 
 #if defined(CONFIG_SCHED_CPULOAD_SYSCLK) || \
@@ -438,6 +509,143 @@ FAR char **nxsched_get_stackargs(FAR struct tcb_s *tcb);
  * Inline functions
  ****************************************************************************/
 
+#ifdef CONFIG_SCHED_PRIORITY_BITMAP
+/* Return the priority index associated with a task list or NULL if the
+ * list is not indexed.
+ */
+
+static inline_function FAR struct prioindex_s *
+nxsched_prioindex(DSEG dq_queue_t *list)
+{
+  if (list == list_readytorun())
+    {
+      return &g_readytorun_index;
+    }
+
+#ifdef CONFIG_SMP
+  if (list >= g_assignedtasks && list < &g_assignedtasks[CONFIG_SMP_NCPUS])
+    {
+      return &g_assignedtasks_index[list - g_assignedtasks];
+    }
+#endif
+
+  return NULL;
+}
+
+/* Return the last TCB in the indexed list with a priority greater than or
+ * equal to sched_priority, i.e. the TCB after which a new TCB of that
+ * priority must be inserted.  NULL means that the new TCB goes at the head
+ * of the list.
+ */
+
+static inline_function FAR struct tcb_s *
+nxsched_prioindex_find(FAR struct prioindex_s *index, uint8_t sched_priority)
+{
+  int word = sched_priority >> 5;
+  uint32_t bits;
+
+  bits = index->bitmap[word] & (UINT32_MAX << (sched_priority & 31));
+  while (bits == 0)
+    {
+      if (++word >= (SCHED_PRIORITY_MAX + 32) >> 5)
+        {
+          return NULL;
+        }
+
+      bits = index->bitmap[word];
+    }
+
+  return index->tail[(word << 5) + ffs(bits) - 1];
+}
+
+/* Account for a TCB that has just been linked into an indexed list */
+
+static inline_function void
+nxsched_prioindex_link(FAR struct prioindex_s *index, FAR struct tcb_s *tcb)
+{
+  uint8_t sched_priority = tcb->sched_priority;
+  FAR struct tcb_s *next = tcb->flink;
+
+  /* The TCB ends the run of its priority unless it was placed before
+   * another TCB of the same priority (which only happens at the head or
+   * ahead of a SCHED_DEADLINE TCB with a later deadline).
+   */
+
+  if (next == NULL || next->sched_priority != sched_priority)
+    {
+      index->tail[sched_priority] = tcb;
+      index->bitmap[sched_priority >> 5] |=
+        (uint32_t)1 << (sched_priority & 31);
+    }
+}
+
+/* Account for a TCB that is about to be unlinked from an indexed list */
+
+static inline_function void
+nxsched_prioindex_unlink(FAR struct prioindex_s *index,
+                         FAR struct tcb_s *tcb)
+{
+  uint8_t sched_priority = tcb->sched_priority;
+  FAR struct tcb_s *prev;
+
+  if (index->tail[sched_priority] == tcb)
+    {
+      prev = tcb->blink;
+      if (prev != NULL && prev->sched_priority == sched_priority)
+        {
+          index->tail[sched_priority] = prev;
+        }
+      else
+        {
+          index->tail[sched_priority] = NULL;
+          index->bitmap[sched_priority >> 5] &=
+            ~((uint32_t)1 << (sched_priority & 31));
+        }
+    }
+}
+
+static inline_function void nxsched_prioindex_insert(FAR struct tcb_s *tcb,
+                                                     DSEG dq_queue_t *list)
+{
+  FAR struct prioindex_s *index = nxsched_prioindex(list);
+
+  if (index != NULL)
+    {
+      nxsched_prioindex_link(index, tcb);
+    }
+}
+
+static inline_function void nxsched_prioindex_remove(FAR struct tcb_s *tcb,
+                                                     DSEG dq_queue_t *list)
+{
+  FAR struct prioindex_s *index = nxsched_prioindex(list);
+
+  if (index != NULL)
+    {
+      nxsched_prioindex_unlink(index, tcb);
+    }
+}
+#endif /* CONFIG_SCHED_PRIORITY_BITMAP */
+
+/* Return true if 'tcb' must be scheduled ahead of 'rtcb':  It has a higher
+ * priority or, for two SCHED_DEADLINE TCBs of the same priority, an earlier
+ * absolute deadline.
+ */
+
+static inline_function bool nxsched_preempts(FAR struct tcb_s *tcb,
+                                             FAR struct tcb_s *rtcb)
+{
+#ifdef CONFIG_SCHED_DEADLINE
+  if (tcb->sched_priority == rtcb->sched_priority &&
+      nxsched_is_deadline(tcb) && nxsched_is_deadline(rtcb))
+    {
+      return (sclock_t)(tcb->dl.absdeadline - rtcb->dl.absdeadline) < 0;
+    }
+#endif
+
+  return tcb->sched_priority > rtcb->sched_priority;
+}
+
 static inline_function bool nxsched_add_prioritized(FAR struct tcb_s *tcb,
                                                     DSEG dq_queue_t *list)
 {
@@ -445,18 +653,47 @@ static inline_function bool nxsched_add_prioritized(FAR struct tcb_s *tcb,
   FAR struct tcb_s *prev;
   uint8_t sched_priority = tcb->sched_priority;
   bool ret = false;
+#ifdef CONFIG_SCHED_PRIORITY_BITMAP
+  FAR struct prioindex_s *index = nxsched_prioindex(list);
+#endif
 
   /* Lets do a sanity check before we get started. */
 
   DEBUGASSERT(sched_priority >= SCHED_PRIORITY_MIN);
 
-  /* Search the list to find the location to insert the new Tcb.
-   * Each is list is maintained in descending sched_priority order.
+#ifdef CONFIG_SCHED_PRIORITY_BITMAP
+  /* If the list is indexed, the new TCB goes just after the last TCB of
+   * equal or higher priority.
    */
 
-  for (next = (FAR struct tcb_s *)list->head;
-       (next && sched_priority <= next->sched_priority);
-       next = next->flink);
+  if (index != NULL)
+    {
+      prev = nxsched_prioindex_find(index, sched_priority);
+
+#ifdef CONFIG_SCHED_DEADLINE
+      /* Within the run of its priority, a SCHED_DEADLINE TCB goes ahead of
+       * those with a later deadline.
+       */
+
+      while (prev != NULL && nxsched_preempts(tcb, prev))
+        {
+          prev = prev->blink;
+        }
+#endif
+
+      next = prev != NULL ? prev->flink : (FAR struct tcb_s *)list->head;
+    }
+  else
+#endif
+    {
+      /* Search the list to find the location to insert the new Tcb.
+       * Each is list is maintained in descending sched_priority order.
+       */
+
+      for (next = (FAR struct tcb_s *)list->head;
+           (next && !nxsched_preempts(tcb, next));
+           next = next->flink);
+    }
 
   /* Add the tcb to the spot found in the list.  Check if the tcb
    * goes at the end of the list. NOTE:  This could only happen if list
@@ -514,6 +751,13 @@ static inline_function bool nxsched_add_prioritized(FAR struct tcb_s *tcb,
         }
     }
 
+#ifdef CONFIG_SCHED_PRIORITY_BITMAP
+  if (index != NULL)
+    {
+      nxsched_prioindex_link(index, tcb);
+    }
+#endif
+
   return ret;
 }
 
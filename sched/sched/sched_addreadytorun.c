@@ -77,8 +77,7 @@ bool nxsched_add_readytorun(FAR struct tcb_s *btcb)
    * also disabled.
    */
 
-  if (nxsched_islocked_tcb(rtcb) &&
-      rtcb->sched_priority < btcb->sched_priority)
+  if (nxsched_islocked_tcb(rtcb) && nxsched_preempts(btcb, rtcb))
     {
       /* Yes.  Preemption would occur!  Add the new ready-to-run task to the
        * g_pendingtasks task list for now.
@@ -174,7 +173,7 @@ bool nxsched_add_readytorun(FAR struct tcb_s *btcb)
    * required.
    */
 
-  if (rtcb->sched_priority < btcb->sched_priority)
+  if (nxsched_preempts(btcb, rtcb))
     {
       task_state = TSTATE_TASK_RUNNING;
     }
@@ -208,6 +207,17 @@ bool nxsched_add_readytorun(FAR struct tcb_s *btcb)
     }
   else if (task_state == TSTATE_TASK_READYTORUN)
     {
+#ifdef CONFIG_SCHED_PERCPU_RUNQUEUE
+      /* Queue the task behind the running task of the selected CPU.  If
+       * some other CPU runs out of higher priority work first, it will
+       * steal the task from there.
+       */
+
+      nxsched_add_prioritized(btcb, list_assignedtasks(cpu));
+
+      btcb->cpu        = cpu;
+      btcb->task_state = TSTATE_TASK_ASSIGNED;
+#else
       /* The new btcb was added either (1) in the middle of the assigned
        * task list (the btcb->cpu field is already valid) or (2) was
        * added to the ready-to-run list (the btcb->cpu field does not
@@ -219,6 +229,7 @@ bool nxsched_add_readytorun(FAR struct tcb_s *btcb)
       nxsched_add_prioritized(btcb, list_readytorun());
 
       btcb->task_state = TSTATE_TASK_READYTORUN;
+#endif
       doswitch         = false;
     }
   else /* (task_state == TSTATE_TASK_RUNNING) */
@@ -240,7 +251,7 @@ bool nxsched_add_readytorun(FAR struct tcb_s *btcb)
           else
             {
               rtcb = g_delivertasks[cpu];
-              if (rtcb->sched_priority < btcb->sched_priority)
+              if (nxsched_preempts(btcb, rtcb))
                 {
                   g_delivertasks[cpu] = btcb;
                   btcb->cpu = cpu;
@@ -271,6 +282,7 @@ bool nxsched_add_readytorun(FAR struct tcb_s *btcb)
        */
 
       dq_addfirst_nonempty((FAR dq_entry_t *)btcb, tasklist);
+      nxsched_prioindex_insert(btcb, tasklist);
       up_update_task(btcb);
 
       DEBUGASSERT(task_state == TSTATE_TASK_RUNNING);
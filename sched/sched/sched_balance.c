@@ -0,0 +1,195 @@
+/****************************************************************************
+ * sched/sched/sched_balance.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <sched.h>
+#include <assert.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/sched.h>
+
+#include "sched/queue.h"
+#include "sched/sched.h"
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+#if defined(CONFIG_SCHED_PERCPU_BALANCE_INTERVAL) && \
+    CONFIG_SCHED_PERCPU_BALANCE_INTERVAL > 0
+/* Ticks remaining until the next rebalancing pass */
+
+static int g_balance_ticks = CONFIG_SCHED_PERCPU_BALANCE_INTERVAL;
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxsched_steal_task
+ *
+ * Description:
+ *   Search the assigned task lists of all other CPUs for the highest
+ *   priority task that is ready-to-run but not running, that is not locked
+ *   to its CPU and whose affinity mask permits it to run on 'cpu'.  If such
+ *   a task with a priority above 'minprio' is found, it is removed from its
+ *   assigned task list and returned.
+ *
+ * Input Parameters:
+ *   cpu     - The CPU that wants to take over the work
+ *   minprio - Only tasks of strictly higher priority are considered
+ *
+ * Returned Value:
+ *   The TCB of the stolen task (no longer in any list, in the state
+ *   TSTATE_TASK_INVALID) or NULL if there is nothing to steal.
+ *
+ * Assumptions:
+ *   The caller has established a critical section.
+ *
+ ****************************************************************************/
+
+FAR struct tcb_s *nxsched_steal_task(int cpu, int minprio)
+{
+  FAR struct tcb_s *best = NULL;
+  FAR struct tcb_s *tcb;
+  int bestcpu = 0;
+  int i;
+
+  for (i = 0; i < CONFIG_SMP_NCPUS; i++)
+    {
+      if (i == cpu)
+        {
+          continue;
+        }
+
+      /* The assigned task list is prioritized, so the first eligible TCB
+       * after the running task is the best candidate from this CPU.  The
+       * IDLE task at the tail is never eligible.
+       */
+
+      for (tcb = current_task(i)->flink;
+           tcb != NULL && !is_idle_task(tcb);
+           tcb = tcb->flink)
+        {
+          if (tcb->sched_priority <= minprio ||
+              (best != NULL && tcb->sched_priority <= best->sched_priority))
+            {
+              break;
+            }
+
+          if (tcb->task_state == TSTATE_TASK_ASSIGNED &&
+              (tcb->flags & TCB_FLAG_CPU_LOCKED) == 0 &&
+              CPU_ISSET(cpu, &tcb->affinity))
+            {
+              best    = tcb;
+              bestcpu = i;
+              break;
+            }
+        }
+    }
+
+  if (best != NULL)
+    {
+      /* The TCB lies between the running task and the IDLE task */
+
+      nxsched_prioindex_remove(best, &g_assignedtasks[bestcpu]);
+      dq_rem_mid(best);
+      best->task_state = TSTATE_TASK_INVALID;
+    }
+
+  return best;
+}
+
+/****************************************************************************
+ * Name: nxsched_process_balance
+ *
+ * Description:
+ *   Called from the system timer to periodically rebalance the per-CPU
+ *   run queues.  Any CPU that is running a task of lower priority than a
+ *   migratable task queued behind the running task on another CPU (or that
+ *   is idle while such a task exists) takes that task over.
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_SCHED_PERCPU_BALANCE_INTERVAL) && \
+    CONFIG_SCHED_PERCPU_BALANCE_INTERVAL > 0
+void nxsched_process_balance(void)
+{
+  FAR struct tcb_s *rtcb;
+  FAR struct tcb_s *tcb;
+  irqstate_t flags;
+  int cpu;
+
+  if (--g_balance_ticks > 0)
+    {
+      return;
+    }
+
+  g_balance_ticks = CONFIG_SCHED_PERCPU_BALANCE_INTERVAL;
+
+  flags = enter_critical_section();
+
+  for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      rtcb = current_task(cpu);
+
+      /* Leave the CPU alone if it cannot be preempted right now or if it
+       * is already about to receive a new task.
+       */
+
+      if (nxsched_islocked_tcb(rtcb) || g_delivertasks[cpu] != NULL)
+        {
+          continue;
+        }
+
+      tcb = nxsched_steal_task(cpu, rtcb->sched_priority);
+      if (tcb != NULL)
+        {
+          /* nxsched_add_readytorun() will select the CPU running the
+           * lowest priority task within the affinity mask, which is at
+           * worst 'cpu' itself.
+           */
+
+          rtcb = this_task();
+          if (nxsched_add_readytorun(tcb))
+            {
+              up_switch_context(this_task(), rtcb);
+            }
+        }
+    }
+
+  leave_critical_section(flags);
+}
+#endif
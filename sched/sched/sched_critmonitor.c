@@ -98,6 +98,10 @@ clock_t g_preemp_max[CONFIG_SMP_NCPUS];
 
 #if CONFIG_SCHED_CRITMONITOR_MAXTIME_CSECTION >= 0
 clock_t g_crit_max[CONFIG_SMP_NCPUS];
+
+/* Number of times the critical section was entered on each CPU */
+
+unsigned long g_crit_count[CONFIG_SMP_NCPUS];
 #endif
 
 /****************************************************************************
@@ -236,6 +240,7 @@ void nxsched_critmon_csection(FAR struct tcb_s *tcb, bool state,
 
       tcb->crit_start  = current;
       tcb->crit_caller = caller;
+      g_crit_count[this_cpu()]++;
     }
   else
     {
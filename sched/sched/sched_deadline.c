@@ -0,0 +1,461 @@
+/****************************************************************************
+ * sched/sched/sched_deadline.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <sched.h>
+#include <time.h>
+#include <sys/param.h>
+#include <assert.h>
+#include <errno.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/arch.h>
+#include <nuttx/clock.h>
+#include <nuttx/signal.h>
+
+#include "sched/sched.h"
+
+#ifdef CONFIG_SCHED_DEADLINE
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Bandwidths (runtime / period) are kept as Q20 fixed point fractions */
+
+#define DEADLINE_BW_SHIFT  20
+#define DEADLINE_BW_MAX \
+  ((uint32_t)(((uint64_t)CONFIG_SCHED_DEADLINE_MAXUTIL << \
+               DEADLINE_BW_SHIFT) / 100) * CONFIG_SMP_NCPUS)
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The sum of the bandwidths of all admitted SCHED_DEADLINE threads */
+
+static uint32_t g_deadline_bw;
+
+#ifdef CONFIG_SMP
+static struct smp_call_data_s g_call_data;
+#endif
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_SMP
+static int nxsched_deadline_handler(FAR void *cookie)
+{
+  pid_t pid = (uintptr_t)cookie;
+  FAR struct tcb_s *tcb;
+  irqstate_t flags;
+
+  flags = enter_critical_section();
+  tcb = nxsched_get_tcb(pid);
+
+  if (!tcb || tcb->task_state == TSTATE_TASK_INVALID ||
+      (tcb->flags & TCB_FLAG_EXIT_PROCESSING) != 0)
+    {
+      /* There is no TCB with this pid or, if there is, it is not a task. */
+
+      leave_critical_section(flags);
+      return OK;
+    }
+
+  if (tcb->task_state == TSTATE_TASK_RUNNING && tcb->cpu == this_cpu() &&
+      nxsched_reprioritize_rtr(tcb, tcb->sched_priority))
+    {
+      up_switch_context(this_task(), tcb);
+    }
+
+  leave_critical_section(flags);
+  return OK;
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxsched_set_deadline
+ *
+ * Description:
+ *   Validate and admit new SCHED_DEADLINE parameters for a thread and start
+ *   its first job.  The admission test rejects the parameters if the total
+ *   bandwidth of all deadline threads would exceed
+ *   CONFIG_SCHED_DEADLINE_MAXUTIL percent of the CPUs.  The bandwidth
+ *   previously admitted for the same thread is not counted twice.
+ *
+ * Input Parameters:
+ *   tcb   - The TCB of the thread
+ *   param - The new scheduling parameters
+ *
+ * Returned Value:
+ *   0 (OK) on success; a negated errno value on failure:
+ *
+ *   EINVAL The parameters do not satisfy runtime <= deadline <= period.
+ *   EBUSY  The parameters fail the admission test.
+ *
+ * Assumptions:
+ *   The scheduling policy bits of the TCB are set by the caller.
+ *
+ ****************************************************************************/
+
+int nxsched_set_deadline(FAR struct tcb_s *tcb,
+                         FAR const struct sched_param *param)
+{
+  FAR struct deadline_s *dl = &tcb->dl;
+  irqstate_t flags;
+  sclock_t runtime;
+  sclock_t deadline;
+  sclock_t period;
+  uint32_t bandwidth;
+  uint32_t total;
+  clock_t now;
+
+  /* Convert timespec values to system clock ticks */
+
+  runtime  = clock_time2ticks(&param->sched_dl_runtime);
+  deadline = clock_time2ticks(&param->sched_dl_deadline);
+  period   = clock_time2ticks(&param->sched_dl_period);
+
+  /* A zero period means that the period equals the deadline */
+
+  if (period < 1)
+    {
+      period = deadline;
+    }
+
+  if (runtime < 1 || runtime > deadline || deadline > period)
+    {
+      return -EINVAL;
+    }
+
+  bandwidth = ((uint64_t)runtime << DEADLINE_BW_SHIFT) / period;
+
+  flags = enter_critical_section();
+
+  total = g_deadline_bw - dl->bandwidth + bandwidth;
+  if (total > DEADLINE_BW_MAX)
+    {
+      leave_critical_section(flags);
+      return -EBUSY;
+    }
+
+  /* Statistics start over when a thread enters SCHED_DEADLINE */
+
+  if (dl->bandwidth == 0)
+    {
+      dl->misses   = 0;
+      dl->overruns = 0;
+    }
+
+  g_deadline_bw  = total;
+  dl->bandwidth  = bandwidth;
+  dl->runtime    = runtime;
+  dl->deadline   = deadline;
+  dl->period     = period;
+
+  /* The first job is released now */
+
+  now             = clock_systime_ticks();
+  dl->absdeadline = now + deadline;
+  dl->release     = now + period;
+  tcb->timeslice  = runtime;
+
+  leave_critical_section(flags);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: nxsched_get_deadline
+ *
+ * Description:
+ *   Return the SCHED_DEADLINE parameters of a thread.  The parameters are
+ *   zero if the thread does not use SCHED_DEADLINE.
+ *
+ * Input Parameters:
+ *   tcb   - The TCB of the thread
+ *   param - The location to return the parameters
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void nxsched_get_deadline(FAR struct tcb_s *tcb,
+                          FAR struct sched_param *param)
+{
+  FAR struct deadline_s *dl = &tcb->dl;
+
+  if (nxsched_is_deadline(tcb))
+    {
+      clock_ticks2time(&param->sched_dl_runtime, dl->runtime);
+      clock_ticks2time(&param->sched_dl_deadline, dl->deadline);
+      clock_ticks2time(&param->sched_dl_period, dl->period);
+    }
+  else
+    {
+      param->sched_dl_runtime.tv_sec   = 0;
+      param->sched_dl_runtime.tv_nsec  = 0;
+      param->sched_dl_deadline.tv_sec  = 0;
+      param->sched_dl_deadline.tv_nsec = 0;
+      param->sched_dl_period.tv_sec    = 0;
+      param->sched_dl_period.tv_nsec   = 0;
+    }
+}
+
+/****************************************************************************
+ * Name: nxsched_stop_deadline
+ *
+ * Description:
+ *   Release the bandwidth reserved for a thread that leaves SCHED_DEADLINE
+ *   or exits.  This does nothing if no bandwidth was reserved.
+ *
+ * Input Parameters:
+ *   tcb - The TCB of the thread
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void nxsched_stop_deadline(FAR struct tcb_s *tcb)
+{
+  irqstate_t flags;
+
+  flags = enter_critical_section();
+  g_deadline_bw     -= tcb->dl.bandwidth;
+  tcb->dl.bandwidth  = 0;
+  leave_critical_section(flags);
+}
+
+/****************************************************************************
+ * Name: nxsched_wakeup_deadline
+ *
+ * Description:
+ *   Apply the constant bandwidth server wakeup rule when a SCHED_DEADLINE
+ *   thread becomes ready-to-run again:  If the current deadline has passed,
+ *   or if running the remaining budget before it would exceed the reserved
+ *   bandwidth, a new job is started with a fresh deadline and budget.
+ *
+ * Input Parameters:
+ *   tcb - The TCB of the thread
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   The caller has established a critical section.
+ *
+ ****************************************************************************/
+
+void nxsched_wakeup_deadline(FAR struct tcb_s *tcb)
+{
+  FAR struct deadline_s *dl = &tcb->dl;
+  clock_t now = clock_systime_ticks();
+  clock_t remaining = dl->absdeadline - now;
+  uint64_t budget = tcb->timeslice > 0 ? tcb->timeslice : 0;
+
+  if ((sclock_t)remaining <= 0 ||
+      budget * dl->period > (uint64_t)remaining * dl->runtime)
+    {
+      dl->absdeadline = now + dl->deadline;
+      tcb->timeslice  = dl->runtime;
+    }
+}
+
+/****************************************************************************
+ * Name: nxsched_yield_deadline
+ *
+ * Description:
+ *   Called from sched_yield() to signal that the current job of a
+ *   SCHED_DEADLINE thread is complete.  The thread sleeps until the
+ *   release of its next job.  If the next period has already begun, the
+ *   next job starts immediately.
+ *
+ * Input Parameters:
+ *   tcb - The TCB of the running thread
+ *
+ * Returned Value:
+ *   0 (OK) on success; a negated errno value if the sleep was interrupted.
+ *
+ ****************************************************************************/
+
+int nxsched_yield_deadline(FAR struct tcb_s *tcb)
+{
+  FAR struct deadline_s *dl = &tcb->dl;
+  struct timespec abstime;
+  irqstate_t flags;
+  clock_t release;
+  clock_t now;
+  int ret;
+
+  flags = enter_critical_section();
+
+  now     = clock_systime_ticks();
+  release = dl->release;
+
+  if (clock_compare(release, now))
+    {
+      /* The job has run into the next period.  Start the next job now and
+       * move the thread behind those with an earlier deadline.
+       */
+
+      dl->release     = now + dl->period;
+      dl->absdeadline = now + dl->deadline;
+      tcb->timeslice  = dl->runtime;
+
+      ret = nxsched_set_priority(tcb, tcb->sched_priority);
+    }
+  else
+    {
+      /* Sleep until the next job is released.  The new deadline and budget
+       * are assigned by nxsched_wakeup_deadline() when the thread wakes up.
+       */
+
+      dl->release = release + dl->period;
+      clock_ticks2time(&abstime, release);
+
+      ret = nxsig_clockwait(CLOCK_MONOTONIC, TIMER_ABSTIME, &abstime, NULL);
+    }
+
+  leave_critical_section(flags);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: nxsched_process_deadline
+ *
+ * Description:
+ *   Charge elapsed time to the budget of the running SCHED_DEADLINE thread.
+ *   If the budget is exhausted or the deadline has passed, the miss is
+ *   counted, the deadline is postponed by one period and the budget is
+ *   replenished.  The thread is then requeued behind the deadline threads
+ *   that now have an earlier deadline.
+ *
+ * Input Parameters:
+ *   tcb        - The TCB of the currently executing task
+ *   ticks      - The number of ticks that have elapsed on the interval
+ *                timer.
+ *   noswitches - True: Can't do context switches now.
+ *
+ * Returned Value:
+ *   The number of ticks until the budget or the deadline of the current
+ *   job expires.  Zero is returned if the thread cannot be requeued now
+ *   because pre-emption is disabled; sched_unlock() will do that.  The
+ *   value one is returned if noswitches is true and the thread must be
+ *   requeued as soon as possible.
+ *
+ * Assumptions:
+ *   - Interrupts are disabled
+ *   - The task associated with TCB uses the SCHED_DEADLINE policy
+ *
+ ****************************************************************************/
+
+uint32_t nxsched_process_deadline(FAR struct tcb_s *tcb, uint32_t ticks,
+                                  bool noswitches)
+{
+  FAR struct deadline_s *dl;
+  FAR struct tcb_s *rtcb;
+  clock_t now;
+  bool missed;
+  int decr;
+
+  DEBUGASSERT(tcb != NULL);
+  dl = &tcb->dl;
+
+  /* Charge the elapsed time to the budget of the current job */
+
+  decr = MIN(tcb->timeslice, ticks);
+  tcb->timeslice -= decr;
+
+  now    = clock_systime_ticks();
+  missed = clock_compare(dl->absdeadline, now);
+
+  if (!missed && tcb->timeslice > 0)
+    {
+      return MIN((clock_t)tcb->timeslice, dl->absdeadline - now);
+    }
+
+  if (nxsched_islocked_tcb(tcb))
+    {
+      return 0;
+    }
+
+  if (noswitches)
+    {
+      return 1;
+    }
+
+  if (missed)
+    {
+      dl->misses++;
+    }
+  else
+    {
+      dl->overruns++;
+    }
+
+  /* Postpone the deadline and replenish the budget so that the job cannot
+   * use more than its reserved bandwidth at the expense of the others.
+   */
+
+  do
+    {
+      dl->absdeadline += dl->period;
+    }
+  while (clock_compare(dl->absdeadline, now));
+
+  tcb->timeslice = dl->runtime;
+
+  /* Requeue the thread according to its new deadline */
+
+  rtcb = this_task();
+
+#ifdef CONFIG_SMP
+  if (tcb->task_state == TSTATE_TASK_RUNNING && tcb->cpu != this_cpu())
+    {
+      nxsched_smp_call_init(&g_call_data, nxsched_deadline_handler,
+                            (FAR void *)(uintptr_t)tcb->pid);
+      nxsched_smp_call_single_async(tcb->cpu, &g_call_data);
+    }
+  else
+#endif
+  if (nxsched_reprioritize_rtr(tcb, tcb->sched_priority))
+    {
+      up_switch_context(this_task(), rtcb);
+    }
+
+  return tcb->timeslice;
+}
+
+#endif /* CONFIG_SCHED_DEADLINE */
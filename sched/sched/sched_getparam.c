@@ -88,6 +88,10 @@ int nxsched_get_param(pid_t pid, FAR struct sched_param *param)
       /* Return the priority if the calling task. */
 
       param->sched_priority = (int)rtcb->sched_priority;
+
+#ifdef CONFIG_SCHED_DEADLINE
+      nxsched_get_deadline(rtcb, param);
+#endif
     }
 
   /* This PID is not for the calling task, we will have to look it up */
@@ -138,6 +142,12 @@ int nxsched_get_param(pid_t pid, FAR struct sched_param *param)
               param->sched_ss_init_budget.tv_nsec = 0;
             }
 #endif
+
+#ifdef CONFIG_SCHED_DEADLINE
+          /* Return parameters associated with SCHED_DEADLINE */
+
+          nxsched_get_deadline(tcb, param);
+#endif
         }
 
       leave_critical_section(flags);
@@ -89,6 +89,15 @@ int nxsched_get_scheduler(pid_t pid)
       return -ESRCH;
     }
 
+#ifdef CONFIG_SCHED_DEADLINE
+  /* SCHED_DEADLINE does not follow the numbering of the other policies */
+
+  if (nxsched_is_deadline(tcb))
+    {
+      return SCHED_DEADLINE;
+    }
+#endif
+
   /* Return the scheduling policy from the TCB.  NOTE that the user-
    * interpretable values are 1 based; the TCB values are zero-based.
    */
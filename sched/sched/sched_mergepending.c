@@ -107,7 +107,7 @@ bool nxsched_merge_pending(void)
            */
 
           for (;
-               (rtcb && ptcb->sched_priority <= rtcb->sched_priority);
+               (rtcb && !nxsched_preempts(ptcb, rtcb));
                rtcb = rtcb->flink)
             {
             }
@@ -148,6 +148,8 @@ bool nxsched_merge_pending(void)
               ptcb->task_state  = TSTATE_TASK_READYTORUN;
             }
 
+          nxsched_prioindex_insert(ptcb, list_readytorun());
+
           /* Set up for the next time through */
 
           rtcb = ptcb;
@@ -224,7 +226,7 @@ bool nxsched_merge_pending(void)
        * end up in the g_readytorun list.
        */
 
-      while (ptcb->sched_priority > rtcb->sched_priority)
+      while (nxsched_preempts(ptcb, rtcb))
         {
           /* Remove the task from the pending task list */
 
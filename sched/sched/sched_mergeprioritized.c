@@ -79,6 +79,7 @@ void nxsched_merge_prioritized(FAR dq_queue_t *list1, FAR dq_queue_t *list2,
    */
 
   dq_move(list1, &clone);
+  nxsched_prioindex_rebuild(list1);
 
   /* Get the TCB at the head of list1 */
 
@@ -110,6 +111,7 @@ void nxsched_merge_prioritized(FAR dq_queue_t *list1, FAR dq_queue_t *list2,
       /* Special case.. list2 is empty.  Move list1 to list2. */
 
       dq_move(&clone, list2);
+      nxsched_prioindex_rebuild(list2);
       return;
     }
 
@@ -134,7 +136,7 @@ void nxsched_merge_prioritized(FAR dq_queue_t *list1, FAR dq_queue_t *list2,
 
       /* Which TCB has higher priority? */
 
-      else if (tcb1->sched_priority > tcb2->sched_priority)
+      else if (nxsched_preempts(tcb1, tcb2))
         {
           /* The TCB from list1 has higher priority than the TCB from list2.
            * Remove the TCB from list1 and insert it before the TCB from
@@ -159,4 +161,6 @@ void nxsched_merge_prioritized(FAR dq_queue_t *list1, FAR dq_queue_t *list2,
         }
     }
   while (tcb1 != NULL);
+
+  nxsched_prioindex_rebuild(list2);
 }
@@ -0,0 +1,127 @@
+/****************************************************************************
+ * sched/sched/sched_prioindex.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <string.h>
+#include <sched.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/sched.h>
+
+#include "sched/sched.h"
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/* Priority index of the g_readytorun list */
+
+struct prioindex_s g_readytorun_index;
+
+/* Priority indexes of the g_assignedtasks[] lists */
+
+#ifdef CONFIG_SMP
+struct prioindex_s g_assignedtasks_index[CONFIG_SMP_NCPUS];
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxsched_prioindex_rebuild
+ *
+ * Description:
+ *   Reconstruct the priority index of a task list from scratch.  This is
+ *   needed only after bulk operations, such as nxsched_merge_prioritized(),
+ *   that splice whole lists without going through nxsched_add_prioritized().
+ *
+ * Input Parameters:
+ *   list - The task list whose index must be rebuilt.  Nothing is done if
+ *          the list is not indexed.
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   The caller has established a critical section.
+ *
+ ****************************************************************************/
+
+void nxsched_prioindex_rebuild(FAR dq_queue_t *list)
+{
+  FAR struct prioindex_s *index = nxsched_prioindex(list);
+  FAR struct tcb_s *tcb;
+
+  if (index != NULL)
+    {
+      memset(index, 0, sizeof(*index));
+
+      for (tcb = (FAR struct tcb_s *)list->head; tcb; tcb = tcb->flink)
+        {
+          nxsched_prioindex_link(index, tcb);
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: nxsched_prioindex_update
+ *
+ * Description:
+ *   Change the priority of a running task in place, i.e. without moving it
+ *   within its ready-to-run list.  The caller must already have assured
+ *   that the new priority does not break the ordering of the list.
+ *
+ * Input Parameters:
+ *   tcb - The TCB of the running task.
+ *   sched_priority - The new task priority
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void nxsched_prioindex_update(FAR struct tcb_s *tcb, int sched_priority)
+{
+  FAR dq_queue_t *list;
+  irqstate_t flags;
+
+  flags = enter_critical_section();
+
+#ifdef CONFIG_SMP
+  list = TLIST_HEAD(tcb, tcb->cpu);
+#else
+  list = TLIST_HEAD(tcb);
+#endif
+
+  nxsched_prioindex_remove(tcb, list);
+  tcb->sched_priority = (uint8_t)sched_priority;
+  nxsched_prioindex_insert(tcb, list);
+
+  leave_critical_section(flags);
+}
@@ -63,8 +63,6 @@
 void nxsched_process_delivered(int cpu)
 {
   FAR dq_queue_t *tasklist;
-  FAR struct tcb_s *next;
-  FAR struct tcb_s *prev;
   struct tcb_s *btcb = NULL;
   struct tcb_s *tcb;
 
@@ -105,32 +103,23 @@ void nxsched_process_delivered(int cpu)
     }
 
   btcb = g_delivertasks[cpu];
+  tasklist = &g_assignedtasks[cpu];
 
-  for (next = tcb; btcb->sched_priority <= next->sched_priority;
-      next = next->flink);
-
-  DEBUGASSERT(next);
-
-  prev = next->blink;
-  if (prev == NULL)
+  if (nxsched_add_prioritized(btcb, tasklist))
     {
-      /* Special case:  Insert at the head of the list */
+      /* Special case:  Inserted at the head of the list */
 
-      tasklist = &g_assignedtasks[cpu];
-      dq_addfirst_nonempty((FAR dq_entry_t *)btcb, tasklist);
       btcb->cpu = cpu;
       btcb->task_state = TSTATE_TASK_RUNNING;
       up_update_task(btcb);
 
       DEBUGASSERT(btcb->flink != NULL);
-      DEBUGASSERT(next == btcb->flink);
-      next->task_state = TSTATE_TASK_ASSIGNED;
+      btcb->flink->task_state = TSTATE_TASK_ASSIGNED;
     }
   else
     {
-      /* Insert in the middle of the list */
+      /* Inserted in the middle of the list */
 
-      dq_insert_mid(prev, btcb, next);
       btcb->cpu = cpu;
       btcb->task_state = TSTATE_TASK_ASSIGNED;
     }
@@ -79,4 +79,13 @@ void nxsched_remove_blocked(FAR struct tcb_s *btcb)
    */
 
   btcb->task_state = TSTATE_TASK_INVALID;
+
+#ifdef CONFIG_SCHED_DEADLINE
+  /* A SCHED_DEADLINE thread may need a new deadline after sleeping */
+
+  if (nxsched_is_deadline(btcb))
+    {
+      nxsched_wakeup_deadline(btcb);
+    }
+#endif
 }
@@ -93,6 +93,7 @@ bool nxsched_remove_readytorun(FAR struct tcb_s *rtcb)
    * is always the g_readytorun list.
    */
 
+  nxsched_prioindex_remove(rtcb, tasklist);
   dq_rem((FAR dq_entry_t *)rtcb, tasklist);
 
   /* Since the TCB is not in any list, it is now invalid */
@@ -182,8 +183,25 @@ void nxsched_remove_running(FAR struct tcb_s *tcb)
    * or the g_assignedtasks[cpu] list.
    */
 
+  nxsched_prioindex_remove(tcb, tasklist);
   dq_rem_head((FAR dq_entry_t *)tcb, tasklist);
 
+#ifdef CONFIG_SCHED_PERCPU_RUNQUEUE
+  /* Steal the highest priority migratable task queued on some other CPU
+   * if it is more important than the next task in our own queue.
+   */
+
+  rtrtcb = nxsched_steal_task(cpu, nxttcb->sched_priority);
+  if (rtrtcb != NULL)
+    {
+      dq_addfirst_nonempty((FAR dq_entry_t *)rtrtcb, tasklist);
+      nxsched_prioindex_insert(rtrtcb, tasklist);
+
+      rtrtcb->cpu        = cpu;
+      rtrtcb->task_state = TSTATE_TASK_ASSIGNED;
+      nxttcb             = rtrtcb;
+    }
+#else
   /* Find the highest priority non-running tasks in the g_assignedtasks
    * list of other CPUs, and also non-idle tasks, place them in the
    * g_readytorun list. so as to find the task with the highest priority,
@@ -212,6 +230,7 @@ void nxsched_remove_running(FAR struct tcb_s *tcb)
                * tasks, we can use the dq_rem_mid macro to delete it.
                */
 
+              nxsched_prioindex_remove(rtrtcb, &g_assignedtasks[i]);
               dq_rem_mid(rtrtcb);
               rtrtcb->task_state = TSTATE_TASK_READYTORUN;
 
@@ -224,6 +243,7 @@ void nxsched_remove_running(FAR struct tcb_s *tcb)
             }
         }
     }
+#endif
 
   /* Which task will go at the head of the list?  It will be either the
    * next tcb in the assigned task list (nxttcb) or a TCB in the
@@ -253,8 +273,10 @@ void nxsched_remove_running(FAR struct tcb_s *tcb)
        * list and add to the head of the g_assignedtasks[cpu] list.
        */
 
+      nxsched_prioindex_remove(rtrtcb, &g_readytorun);
       dq_rem((FAR dq_entry_t *)rtrtcb, &g_readytorun);
       dq_addfirst_nonempty((FAR dq_entry_t *)rtrtcb, tasklist);
+      nxsched_prioindex_insert(rtrtcb, tasklist);
 
       rtrtcb->cpu = cpu;
       nxttcb = rtrtcb;
@@ -318,6 +340,7 @@ bool nxsched_remove_readytorun(FAR struct tcb_s *tcb)
        * g_assignedtasks[cpu] list.
        */
 
+      nxsched_prioindex_remove(tcb, tasklist);
       dq_rem((FAR dq_entry_t *)tcb, tasklist);
 
       /* Since the TCB is no longer in any list, it is now invalid */
@@ -73,6 +73,7 @@
  *          current scheduling policy.
  *   EPERM  The calling task does not have appropriate privileges.
  *   ESRCH  The task whose ID is pid could not be found.
+ *   EBUSY  The SCHED_DEADLINE parameters fail the admission test.
  *
  ****************************************************************************/
 
@@ -205,6 +206,24 @@ int nxsched_set_param(pid_t pid, FAR const struct sched_param *param)
     }
 #endif
 
+#ifdef CONFIG_SCHED_DEADLINE
+  /* Update parameters associated with SCHED_DEADLINE */
+
+  if (nxsched_is_deadline(tcb))
+    {
+      irqstate_t flags;
+
+      flags = enter_critical_section();
+      ret = nxsched_set_deadline(tcb, param);
+      leave_critical_section(flags);
+
+      if (ret < 0)
+        {
+          goto errout_with_lock;
+        }
+    }
+#endif
+
   /* Then perform the reprioritization */
 
   ret = nxsched_reprioritize(tcb, param->sched_priority);
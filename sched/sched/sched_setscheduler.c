@@ -74,6 +74,7 @@
  *
  *   EINVAL The scheduling policy is not one of the recognized policies.
  *   ESRCH  The task whose ID is pid could not be found.
+ *   EBUSY  The SCHED_DEADLINE parameters fail the admission test.
  *
  ****************************************************************************/
 
@@ -93,6 +94,9 @@ int nxsched_set_scheduler(pid_t pid, int policy,
 #endif
 #ifdef CONFIG_SCHED_SPORADIC
       && policy != SCHED_SPORADIC
+#endif
+#ifdef CONFIG_SCHED_DEADLINE
+      && policy != SCHED_DEADLINE
 #endif
      )
     {
@@ -134,6 +138,26 @@ int nxsched_set_scheduler(pid_t pid, int policy,
   /* Further, disable timer interrupts while we set up scheduling policy. */
 
   flags = enter_critical_section();
+
+#ifdef CONFIG_SCHED_DEADLINE
+  /* Admit the new deadline parameters before the current policy is given
+   * up, or release the bandwidth of a thread leaving SCHED_DEADLINE.
+   */
+
+  if (policy == SCHED_DEADLINE)
+    {
+      ret = nxsched_set_deadline(tcb, param);
+      if (ret < 0)
+        {
+          goto errout_with_irq;
+        }
+    }
+  else
+    {
+      nxsched_stop_deadline(tcb);
+    }
+#endif
+
   tcb->flags &= ~TCB_FLAG_POLICY_MASK;
   switch (policy)
     {
@@ -152,7 +176,8 @@ int nxsched_set_scheduler(pid_t pid, int policy,
           /* Save the FIFO scheduling parameters */
 
           tcb->flags     |= TCB_FLAG_SCHED_FIFO;
-#if CONFIG_RR_INTERVAL > 0 || defined(CONFIG_SCHED_SPORADIC)
+#if CONFIG_RR_INTERVAL > 0 || defined(CONFIG_SCHED_SPORADIC) || \
+    defined(CONFIG_SCHED_DEADLINE)
           tcb->timeslice  = 0;
 #endif
         }
@@ -269,6 +294,16 @@ int nxsched_set_scheduler(pid_t pid, int policy,
         }
         break;
 #endif
+
+#ifdef CONFIG_SCHED_DEADLINE
+      case SCHED_DEADLINE:
+        {
+          /* nxsched_set_deadline() has already started the first job */
+
+          tcb->flags |= TCB_FLAG_SCHED_DEADLINE;
+        }
+        break;
+#endif
     }
 
   leave_critical_section(flags);
@@ -279,7 +314,7 @@ int nxsched_set_scheduler(pid_t pid, int policy,
   sched_unlock();
   return ret;
 
-#ifdef CONFIG_SCHED_SPORADIC
+#if defined(CONFIG_SCHED_SPORADIC) || defined(CONFIG_SCHED_DEADLINE)
 errout_with_irq:
   leave_critical_section(flags);
   sched_unlock();
@@ -162,6 +162,17 @@ void sched_unlock(void)
             }
 #endif
 
+#ifdef CONFIG_SCHED_DEADLINE
+          /* If the budget or the deadline of a SCHED_DEADLINE task expired
+           * while pre-emption was disabled, postpone the deadline now.
+           */
+
+          if (nxsched_is_deadline(rtcb))
+            {
+              nxsched_process_deadline(rtcb, 0, false);
+            }
+#endif
+
           leave_critical_section_wo_note(flags);
         }
     }
@@ -56,6 +56,18 @@ int sched_yield(void)
   FAR struct tcb_s *rtcb = this_task();
   int ret;
 
+#ifdef CONFIG_SCHED_DEADLINE
+  /* For SCHED_DEADLINE, sched_yield() signals the completion of the
+   * current job.  The thread sleeps until the next period begins.
+   */
+
+  if (nxsched_is_deadline(rtcb))
+    {
+      ret = nxsched_yield_deadline(rtcb);
+      return ret < 0 ? ERROR : OK;
+    }
+#endif
+
   /* This equivalent to just resetting the task priority to its current value
    * since this will cause the task to be rescheduled behind any other tasks
    * at the same priority.
@@ -99,6 +99,18 @@ int nxsem_clockwait(FAR sem_t *sem, clockid_t clockid,
   DEBUGASSERT(sem != NULL && abstime != NULL);
   DEBUGASSERT(up_interrupt_context() == false);
 
+  /* Try to take the semaphore without waiting.  This does not need the
+   * global lock.
+   */
+
+  ret = nxsem_trywait(sem);
+  if (ret == OK)
+    {
+      /* We got it! */
+
+      return OK;
+    }
+
   /* We will disable interrupts until we have completed the semaphore
    * wait.  We need to do this (as opposed to just disabling pre-emption)
    * because there could be interrupt handlers that are asynchronously
@@ -109,16 +121,6 @@ int nxsem_clockwait(FAR sem_t *sem, clockid_t clockid,
 
   flags = enter_critical_section();
 
-  /* Try to take the semaphore without waiting. */
-
-  ret = nxsem_trywait(sem);
-  if (ret == OK)
-    {
-      /* We got it! */
-
-      goto out;
-    }
-
   /* We will have to wait for the semaphore.  Make sure that we were provided
    * with a valid timeout.
    */
@@ -126,8 +128,8 @@ int nxsem_clockwait(FAR sem_t *sem, clockid_t clockid,
 #ifdef CONFIG_DEBUG_FEATURES
   if (abstime->tv_nsec < 0 || abstime->tv_nsec >= 1000000000)
     {
-      ret = -EINVAL;
-      goto out;
+      leave_critical_section(flags);
+      return -EINVAL;
     }
 #endif
 
@@ -154,7 +156,6 @@ int nxsem_clockwait(FAR sem_t *sem, clockid_t clockid,
 
   /* We can now restore interrupts and delete the watchdog */
 
-out:
   leave_critical_section(flags);
   return ret;
 }
@@ -49,6 +49,13 @@
 typedef int (*holderhandler_t)(FAR struct semholder_s *pholder,
                                FAR sem_t *sem, FAR void *arg);
 
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static inline void nxsem_freeholder(FAR sem_t *sem,
+                                    FAR struct semholder_s *pholder);
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -69,28 +76,36 @@ nxsem_allocholder(FAR sem_t *sem, FAR struct tcb_s *htcb)
 {
   FAR struct semholder_s *pholder;
 
+  /* A mutex has only one holder, so any record left in the built-in
+   * holder belongs to a previous holder and can be dropped.
+   */
+
+  if (NXSEM_IS_MUTEX(sem) && sem->holder.htcb != NULL)
+    {
+      nxsem_freeholder(sem, &sem->holder);
+    }
+
   /* Check if the "built-in" holder is being used.  We have this built-in
    * holder to optimize for the simplest case where semaphores are only
-   * used to implement mutexes.
+   * used to implement mutexes.  These never need the pre-allocated pool.
    */
 
+  if (sem->holder.htcb == NULL)
+    {
+      pholder = &sem->holder;
+    }
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
-  pholder = g_freeholders;
-  if (pholder != NULL)
+  else if (g_freeholders != NULL)
     {
       /* Remove the holder from the free list and
        * put it into the semaphore's holder list
        */
 
+      pholder        = g_freeholders;
       g_freeholders  = pholder->flink;
       pholder->flink = sem->hhead;
       sem->hhead     = pholder;
     }
-#else
-  if (sem->holder.htcb == NULL)
-    {
-      pholder = &sem->holder;
-    }
 #endif
   else
     {
@@ -128,9 +143,20 @@ nxsem_findholder(FAR sem_t *sem, FAR struct tcb_s *htcb)
 {
   FAR struct semholder_s *pholder;
 
+  /* We have one hard-allocated holder structures in sem_t */
+
+  pholder = &sem->holder;
+
+  if (pholder->htcb == htcb)
+    {
+      /* Got it! */
+
+      return pholder;
+    }
+
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
-  /* Try to find the holder in the list of holders associated with this
-   * semaphore
+  /* Try to find the holder in the list of additional holders associated
+   * with this semaphore
    */
 
   for (pholder = sem->hhead; pholder != NULL; pholder = pholder->flink)
@@ -142,17 +168,6 @@ nxsem_findholder(FAR sem_t *sem, FAR struct tcb_s *htcb)
           return pholder;
         }
     }
-#else
-  /* We have one hard-allocated holder structures in sem_t */
-
-  pholder = &sem->holder;
-
-  if (pholder->htcb == htcb)
-    {
-      /* Got it! */
-
-      return pholder;
-    }
 #endif
 
   /* The holder does not appear in the list */
@@ -210,6 +225,13 @@ static inline void nxsem_freeholder(FAR sem_t *sem,
   pholder->counts = 0;
 
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
+  /* Nothing more to do for the built-in holder */
+
+  if (pholder == &sem->holder)
+    {
+      return;
+    }
+
   /* Remove the holder from the semaphore's list */
 
   for (curr = &sem->hhead;
@@ -263,31 +285,32 @@ static int nxsem_foreachholder(FAR sem_t *sem, holderhandler_t handler,
 {
   FAR struct semholder_s *pholder;
   int ret = 0;
-
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
   FAR struct semholder_s *next;
+#endif
 
-  for (pholder = sem->hhead; pholder && ret == 0; pholder = next)
-    {
-      /* In case this holder gets deleted */
+  /* We have one hard-allocated holder structures in sem_t */
 
-      next = pholder->flink;
+  pholder = &sem->holder;
 
-      DEBUGASSERT(pholder->htcb != NULL);
+  /* The hard-allocated containers may hold a NULL holder */
 
+  if (pholder->htcb != NULL)
+    {
       /* Call the handler */
 
       ret = handler(pholder, sem, arg);
     }
-#else
-  /* We have one hard-allocated holder structures in sem_t */
 
-  pholder = &sem->holder;
+#if CONFIG_SEM_PREALLOCHOLDERS > 0
+  for (pholder = sem->hhead; pholder && ret == 0; pholder = next)
+    {
+      /* In case this holder gets deleted */
 
-  /* The hard-allocated containers may hold a NULL holder */
+      next = pholder->flink;
+
+      DEBUGASSERT(pholder->htcb != NULL);
 
-  if (pholder->htcb != NULL)
-    {
       /* Call the handler */
 
       ret = handler(pholder, sem, arg);
@@ -587,7 +610,7 @@ void nxsem_destroyholder(FAR sem_t *sem)
        * the semaphore.
        */
 
-      DEBUGASSERT(sem->hhead->flink == NULL);
+      DEBUGASSERT(sem->holder.htcb == NULL && sem->hhead->flink == NULL);
     }
 
 #else
@@ -694,10 +717,16 @@ void nxsem_boost_priority(FAR sem_t *sem)
    */
 
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
-  nxsem_foreachholder(sem, nxsem_boostholderprio, rtcb);
-#else
-  nxsem_boostholderprio(&sem->holder, sem, rtcb);
+  if (!NXSEM_IS_MUTEX(sem))
+    {
+      nxsem_foreachholder(sem, nxsem_boostholderprio, rtcb);
+      return;
+    }
 #endif
+
+  /* A mutex has only the built-in holder */
+
+  nxsem_boostholderprio(&sem->holder, sem, rtcb);
 }
 
 /****************************************************************************
@@ -737,28 +766,44 @@ void nxsem_release_holder(FAR sem_t *sem)
       /* Find the container for this holder */
 
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
-      for (pholder = sem->hhead; pholder != NULL; pholder = pholder->flink)
+      if (!NXSEM_IS_MUTEX(sem))
         {
-          DEBUGASSERT(pholder->counts > 0);
-
-          if (pholder->htcb == rtcb)
+          pholder = nxsem_findholder(sem, rtcb);
+          if (pholder != NULL)
             {
               /* Decrement the counts on this holder -- the holder will be
                * freed later in nxsem_restore_baseprio.
                */
 
+              DEBUGASSERT(pholder->counts > 0);
               pholder->counts--;
-              return;
             }
+
+          return;
         }
-#else
+#endif
+
+      /* Release the built-in holder right away so that it is available
+       * for the next holder.
+       */
+
       pholder = &sem->holder;
       if (pholder->htcb)
         {
-          DEBUGASSERT(pholder->htcb == rtcb);
+          FAR struct tcb_s *htcb = pholder->htcb;
+
+          DEBUGASSERT(htcb == rtcb || NXSEM_IS_MUTEX(sem));
           nxsem_freeholder(sem, pholder);
+
+          /* A mutex that is reset is not released by its holder.  Only the
+           * running task is restored by nxsem_restore_baseprio().
+           */
+
+          if (htcb != rtcb)
+            {
+              nxsem_restore_priority(htcb);
+            }
         }
-#endif
     }
 }
 
@@ -816,35 +861,42 @@ void nxsem_restore_baseprio(FAR struct tcb_s *stcb, FAR sem_t *sem)
   if (stcb != NULL)
     {
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
-      /* The currently executed thread should be the lower priority
-       * thread that just posted the count and caused this action.
-       * However, we cannot drop the priority of the currently running
-       * thread -- because that will cause it to be suspended.
-       *
-       * So, do this in two passes.  First, reprioritizing all holders
-       * except for the running thread.
-       */
+      if (!NXSEM_IS_MUTEX(sem))
+        {
+          /* The currently executed thread should be the lower priority
+           * thread that just posted the count and caused this action.
+           * However, we cannot drop the priority of the currently running
+           * thread -- because that will cause it to be suspended.
+           *
+           * So, do this in two passes.  First, reprioritizing all holders
+           * except for the running thread.
+           */
 
-      nxsem_foreachholder(sem, nxsem_restoreholderprio_others, stcb);
+          nxsem_foreachholder(sem, nxsem_restoreholderprio_others, stcb);
 
-      /* Now, find an reprioritize only the ready to run task */
+          /* Now, find an reprioritize only the ready to run task */
+
+          nxsem_foreachholder(sem, nxsem_restoreholderprio_self, stcb);
+          return;
+        }
+#endif
 
-      nxsem_foreachholder(sem, nxsem_restoreholderprio_self, stcb);
-#else
       /* New owner is already the highest priority since the wait queue
        * is priority-based, no need to adjust its priority, only restore
        * the older owner when posted the count.
        */
 
       nxsem_restore_priority(this_task());
-#endif
     }
   else
     {
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
       /* Remove the holder from the list if it's counts is zero. */
 
-      nxsem_foreachholder(sem, nxsem_freecount0holder, NULL);
+      if (!NXSEM_IS_MUTEX(sem))
+        {
+          nxsem_foreachholder(sem, nxsem_freecount0holder, NULL);
+        }
 
       /* If there are no tasks waiting for available counts, then all holders
        * should be at their base priority.
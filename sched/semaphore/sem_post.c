@@ -80,6 +80,24 @@ int nxsem_post_slow(FAR sem_t *sem)
   bool mutex = NXSEM_IS_MUTEX(sem);
   uint32_t mholder = NXSEM_NO_MHOLDER;
 
+  /* If nobody waits for a counting semaphore without a priority protocol,
+   * posting it is a single atomic increment that needs no global lock.
+   */
+
+  if (!mutex && (sem->flags & SEM_PRIO_MASK) == SEM_PRIO_NONE)
+    {
+      int32_t sem_count = atomic_read(NXSEM_COUNT(sem));
+
+      while (sem_count >= 0 && sem_count < SEM_VALUE_MAX)
+        {
+          if (atomic_try_cmpxchg_release(NXSEM_COUNT(sem), &sem_count,
+                                         sem_count + 1))
+            {
+              return OK;
+            }
+        }
+    }
+
   /* The following operations must be performed with interrupts
    * disabled because sem_post() may be called from an interrupt
    * handler.
@@ -76,7 +76,7 @@ int nxsem_protect_wait(FAR sem_t *sem)
         }
 
       sem->saved = rtcb->sched_priority;
-      rtcb->sched_priority = sem->ceiling;
+      nxsched_prioindex_update(rtcb, sem->ceiling);
     }
 
   return OK;
@@ -72,6 +72,18 @@ int nxsem_tickwait(FAR sem_t *sem, uint32_t delay)
   irqstate_t flags;
   int ret;
 
+  /* Try to take the semaphore without waiting.  This does not need the
+   * global lock.
+   */
+
+  ret = nxsem_trywait(sem);
+  if (ret == OK)
+    {
+      /* We got it! */
+
+      return OK;
+    }
+
   /* We will disable interrupts until we have completed the semaphore
    * wait.  We need to do this (as opposed to just disabling pre-emption)
    * because there could be interrupt handlers that are asynchronously
@@ -82,16 +94,6 @@ int nxsem_tickwait(FAR sem_t *sem, uint32_t delay)
 
   flags = enter_critical_section();
 
-  /* Try to take the semaphore without waiting. */
-
-  ret = nxsem_trywait(sem);
-  if (ret == OK)
-    {
-      /* We got it! */
-
-      goto out;
-    }
-
   /* We will have to wait for the semaphore.  Make sure that we were provided
    * with a valid timeout.
    */
@@ -34,10 +34,42 @@
 #include <nuttx/init.h>
 #include <nuttx/irq.h>
 #include <nuttx/arch.h>
+#include <nuttx/spinlock.h>
 
 #include "sched/sched.h"
 #include "semaphore/semaphore.h"
 
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+/****************************************************************************
+ * Name: nxsem_holder_running
+ *
+ * Description:
+ *   Return true if htcb is running on one of the CPUs.  htcb is only
+ *   compared with the running TCBs and never dereferenced, since the holder
+ *   may exit and free it while we spin.
+ *
+ ****************************************************************************/
+
+static bool nxsem_holder_running(FAR struct tcb_s *htcb)
+{
+  int cpu;
+
+  for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      if (g_running_tasks[cpu] == htcb)
+        {
+          return true;
+        }
+    }
+
+  return false;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -62,18 +94,24 @@
 
 int nxsem_trywait_slow(FAR sem_t *sem)
 {
-  irqstate_t flags;
+  irqstate_t flags = 0;
   int ret = -EAGAIN;
   bool mutex = NXSEM_IS_MUTEX(sem);
+  bool csection = NXSEM_TAKE_NEEDS_CSECTION(sem);
   FAR atomic_t *val = mutex ? NXSEM_MHOLDER(sem) : NXSEM_COUNT(sem);
   int32_t old;
   int32_t new;
 
-  /* The following operations must be performed with interrupts disabled
+  /* Without any priority protocol bookkeeping, taking the semaphore is a
+   * single atomic operation that needs no global lock.  Otherwise the
+   * following operations must be performed with interrupts disabled
    * because sem_post() may be called from an interrupt handler.
    */
 
-  flags = enter_critical_section();
+  if (csection)
+    {
+      flags = enter_critical_section();
+    }
 
   /* If the semaphore is available, give it to the requesting task */
 
@@ -118,7 +156,6 @@ int nxsem_trywait_slow(FAR sem_t *sem)
           atomic_fetch_add(NXSEM_COUNT(sem), 1);
         }
 
-      leave_critical_section(flags);
       goto out;
     }
 
@@ -131,6 +168,97 @@ out:
 
   /* Interrupts may now be enabled. */
 
-  leave_critical_section(flags);
+  if (csection)
+    {
+      leave_critical_section(flags);
+    }
+
   return ret;
 }
+
+/****************************************************************************
+ * Name: nxsem_spinwait
+ *
+ * Description:
+ *   Try to take a mutex type semaphore by busy waiting for a bounded time
+ *   while its holder is running on another CPU.
+ *
+ *   The mutex is only ever taken the same way as in the nxsem_wait() fast
+ *   path, i.e. only when it is free and nobody is blocked on it.  Spinning
+ *   stops as soon as a thread blocks on the mutex, so that the hand-over
+ *   and the priority inheritance bookkeeping remain with nxsem_wait().
+ *
+ * Input Parameters:
+ *   sem - the semaphore descriptor
+ *
+ * Returned Value:
+ *   True if the mutex was taken; false otherwise.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+bool nxsem_spinwait(FAR sem_t *sem)
+{
+  FAR struct tcb_s *rtcb = this_task();
+  FAR struct tcb_s *htcb = NULL;
+  uint32_t holder = NXSEM_NO_MHOLDER;
+  int32_t mholder;
+  int count;
+
+  if (!NXSEM_IS_MUTEX(sem) || up_interrupt_context())
+    {
+      return false;
+    }
+
+#ifdef CONFIG_PRIORITY_PROTECT
+  /* The priority ceiling must be applied by the slow path */
+
+  if ((sem->flags & SEM_PRIO_MASK) == SEM_PRIO_PROTECT)
+    {
+      return false;
+    }
+#endif
+
+  for (count = 0; count < CONFIG_MUTEX_ADAPTIVE_SPIN_COUNT; count++)
+    {
+      mholder = atomic_read(NXSEM_MHOLDER(sem));
+
+      if (mholder == NXSEM_NO_MHOLDER)
+        {
+          if (atomic_try_cmpxchg_acquire(NXSEM_MHOLDER(sem), &mholder,
+                                         rtcb->pid))
+            {
+              return true;
+            }
+
+          continue;
+        }
+
+      /* Give up if the mutex is being reset or if there are waiters */
+
+      if (!NXSEM_MACQUIRED(mholder) || NXSEM_MBLOCKING(mholder))
+        {
+          return false;
+        }
+
+      /* Look up the holder only when it changes.  Whether it is still
+       * running is checked without touching its TCB.
+       */
+
+      if ((uint32_t)mholder != holder)
+        {
+          holder = mholder;
+          htcb   = nxsched_get_tcb(holder);
+        }
+
+      if (htcb == NULL || htcb == rtcb || !nxsem_holder_running(htcb))
+        {
+          return false;
+        }
+
+      UP_DMB();
+    }
+
+  return false;
+}
+#endif
@@ -78,6 +78,15 @@ int nxsem_wait_slow(FAR sem_t *sem)
   FAR struct tcb_s *htcb = NULL;
   bool mutex = NXSEM_IS_MUTEX(sem);
 
+  /* An available semaphore can be taken without the global lock if there
+   * is no priority protocol bookkeeping to do.
+   */
+
+  if (!NXSEM_TAKE_NEEDS_CSECTION(sem) && nxsem_trywait_slow(sem) == OK)
+    {
+      return OK;
+    }
+
   /* The following operations must be performed with interrupts
    * disabled because nxsem_post() may be called from an interrupt
    * handler.
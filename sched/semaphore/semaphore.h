@@ -39,6 +39,15 @@
  * Pre-processor Definitions
  ****************************************************************************/
 
+/* Taking a count of a semaphore needs the critical section only if the
+ * holder must be recorded or the priority ceiling applied.  A mutex holder
+ * is only recorded once some thread blocks on it.
+ */
+
+#define NXSEM_TAKE_NEEDS_CSECTION(s) \
+  (((s)->flags & SEM_PRIO_MASK) == SEM_PRIO_PROTECT || \
+   (((s)->flags & SEM_PRIO_MASK) == SEM_PRIO_INHERIT && !NXSEM_IS_MUTEX(s)))
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
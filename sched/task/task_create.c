@@ -82,10 +82,13 @@ int nxthread_create(FAR const char *name, uint8_t ttype, int priority,
   pid_t pid;
   int ret;
 
-  /* Allocate a TCB for the new task. */
+  /* Allocate a TCB for the new task.  Tasks, and the group embedded in
+   * their TCB, usually live as long as the system.
+   */
 
-  tcb = kmm_zalloc(ttype == TCB_FLAG_TTYPE_KERNEL ?
-                   sizeof(struct tcb_s) : sizeof(struct task_tcb_s));
+  tcb = kmm_zalloc_longlived(ttype == TCB_FLAG_TTYPE_KERNEL ?
+                             sizeof(struct tcb_s) :
+                             sizeof(struct task_tcb_s));
   if (!tcb)
     {
       serr("ERROR: Failed to allocate TCB\n");
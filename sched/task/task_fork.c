@@ -148,7 +148,10 @@ FAR struct task_tcb_s *nxtask_setup_fork(start_t retaddr)
   child->cmn.flags |= TCB_FLAG_FREE_TCB;
 
 #if defined(CONFIG_ARCH_ADDRENV)
-  /* Join the parent address environment (REVISIT: vfork() only) */
+  /* Join the parent address environment.  This gives vfork() semantics
+   * only; with CONFIG_ARCH_ADDRENV_COW the child gets its own copy-on-write
+   * duplicate in nxtask_start_fork(), once its stack has been set up.
+   */
 
   if (ttype != TCB_FLAG_TTYPE_KERNEL)
     {
@@ -316,10 +319,29 @@ errout:
 pid_t nxtask_start_fork(FAR struct task_tcb_s *child)
 {
   pid_t pid;
+#ifdef CONFIG_ARCH_ADDRENV_COW
+  int ret;
+#endif
 
   sinfo("Starting Child TCB=%p\n", child);
   DEBUGASSERT(child);
 
+#ifdef CONFIG_ARCH_ADDRENV_COW
+  /* Everything the child needs was written to the shared address
+   * environment by now, so it can be duplicated.
+   */
+
+  if ((child->cmn.flags & TCB_FLAG_TTYPE_MASK) != TCB_FLAG_TTYPE_KERNEL)
+    {
+      ret = addrenv_fork(&child->cmn);
+      if (ret < 0)
+        {
+          nxtask_abort_fork(child, -ret);
+          return ERROR;
+        }
+    }
+#endif
+
   /* Get the assigned pid before we start the task */
 
   pid = child->cmn.pid;
@@ -52,6 +52,7 @@
  * Returned Value:
  *   The returned value may depend on the specific command.  For PR_SET_NAME
  *   and PR_GET_NAME, the returned value of 0 indicates successful operation.
+ *   PR_GET_TIMERSLACK returns the timer slack in nanoseconds.
  *   On any failure, -1 is retruend and the errno value is set appropriately.
  *
  *     EINVAL The value of 'option' is not recognized.
@@ -148,17 +149,42 @@ int prctl(int option, ...)
         goto errout;
 #endif
 
+      case PR_SET_TIMERSLACK:
+#ifdef CONFIG_WDOG_TIMER_SLACK
+        {
+          /* Round down so that the slack never exceeds the request */
+
+          this_task()->timerslack =
+            (clock_t)(va_arg(ap, unsigned long) / NSEC_PER_TICK);
+        }
+        break;
+#else
+        serr("ERROR: Option not enabled: %d\n", option);
+        errcode = ENOSYS;
+        goto errout;
+#endif
+
+      case PR_GET_TIMERSLACK:
+#ifdef CONFIG_WDOG_TIMER_SLACK
+        va_end(ap);
+        return (int)TICK2NSEC(this_task()->timerslack);
+#else
+        serr("ERROR: Option not enabled: %d\n", option);
+        errcode = ENOSYS;
+        goto errout;
+#endif
+
       default:
         serr("ERROR: Unrecognized option: %d\n", option);
         errcode = EINVAL;
         goto errout;
     }
 
-  /* Not reachable unless CONFIG_TASK_NAME_SIZE is > 0.  NOTE: This might
-   * change if additional commands are supported.
+  /* Not reachable unless CONFIG_TASK_NAME_SIZE is > 0 or
+   * CONFIG_WDOG_TIMER_SLACK is enabled.
    */
 
-#if CONFIG_TASK_NAME_SIZE > 0
+#if CONFIG_TASK_NAME_SIZE > 0 || defined(CONFIG_WDOG_TIMER_SLACK)
   va_end(ap);
   return OK;
 #endif
@@ -94,4 +94,10 @@ void nxtask_recover(FAR struct tcb_s *tcb)
       DEBUGVERIFY(nxsched_stop_sporadic(tcb));
     }
 #endif
+
+#ifdef CONFIG_SCHED_DEADLINE
+  /* Release the bandwidth reserved by a SCHED_DEADLINE thread */
+
+  nxsched_stop_deadline(tcb);
+#endif
 }
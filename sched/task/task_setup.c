@@ -463,6 +463,12 @@ static int nxthread_setup_scheduler(FAR struct tcb_s *tcb, int priority,
 
       tcb->sigprocmask = rtcb->sigprocmask;
 
+#ifdef CONFIG_WDOG_TIMER_SLACK
+      /* The timer slack is inherited from the parent thread as well */
+
+      tcb->timerslack = rtcb->timerslack;
+#endif
+
       /* Initialize the task state.  It does not get a valid state
        * until it is activated.
        */
@@ -90,9 +90,9 @@ static int nxtask_spawn_create(FAR const char *name, int priority,
   pid_t pid;
   int ret;
 
-  /* Allocate a TCB for the new task. */
+  /* Allocate a TCB for the new task, see nxthread_create() */
 
-  tcb = kmm_zalloc(sizeof(struct task_tcb_s));
+  tcb = kmm_zalloc_longlived(sizeof(struct task_tcb_s));
   if (tcb == NULL)
     {
       serr("ERROR: Failed to allocate TCB\n");
@@ -80,7 +80,7 @@ int wd_cancel(FAR struct wdog_s *wdog)
    * cancellation is complete
    */
 
-  head = list_is_head(&g_wdactivelist, &wdog->node);
+  head = WDOG_ISHEAD(wdog);
 
   /* Now, remove the watchdog from the timer queue */
 
@@ -26,6 +26,7 @@
 
 #include <nuttx/config.h>
 
+#include <nuttx/clock.h>
 #include <nuttx/list.h>
 
 #include "wdog/wdog.h"
@@ -36,13 +37,61 @@
 
 spinlock_t g_wdspinlock = SP_UNLOCKED;
 
+#ifdef CONFIG_WDOG_TIMER_WHEEL
+/* The g_wdwheel data structure holds the active watchdogs hashed by
+ * expiration time into the slots of a hierarchical timer wheel.
+ */
+
+struct wdog_wheel_s g_wdwheel;
+#else
 /* The g_wdactivelist data structure is a singly linked list ordered by
  * watchdog expiration time. When watchdog timers expire,the functions on
  * this linked list are removed and the function is called.
  */
 
 struct list_node g_wdactivelist = LIST_INITIAL_VALUE(g_wdactivelist);
+#endif
+
+#ifdef CONFIG_WDOG_TIMER_SLACK
+/* Watchdog expiration statistics */
+
+unsigned long g_wdexpired;
+unsigned long g_wdmerged;
+#endif
 
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
+
+/****************************************************************************
+ * Name: wd_initialize
+ *
+ * Description:
+ *   Initialize the watchdog timer wheel.  This must be called before any
+ *   watchdog is started.
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_WDOG_TIMER_WHEEL
+void wd_initialize(void)
+{
+  int level;
+  int i;
+
+  g_wdwheel.base = INITIAL_SYSTEM_TIMER_TICKS;
+
+  for (level = 0; level < WDOG_WHEEL_LEVELS; level++)
+    {
+      for (i = 0; i < WDOG_WHEEL_SIZE; i++)
+        {
+          list_initialize(&g_wdwheel.slot[level][i]);
+        }
+    }
+}
+#endif
@@ -93,10 +93,204 @@
 static unsigned int g_wdtimernested;
 #endif
 
+#ifdef CONFIG_WDOG_TIMER_SLACK
+/* The watchdog expiration time that the interval timer was last set up
+ * for.
+ */
+
+static clock_t g_wdnexttime;
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+#ifdef CONFIG_WDOG_TIMER_WHEEL
+/****************************************************************************
+ * Name: wd_wheel_add
+ *
+ * Description:
+ *   Hash an armed watchdog into the timer wheel slot that covers its
+ *   expiration time.  Expired watchdogs go into the slot of the next tick
+ *   to be processed; watchdogs beyond the range of the wheel are parked in
+ *   the last level and re-hashed when that slot cascades.
+ *
+ * Input Parameters:
+ *   wdog - Watchdog ID with a valid expiration time
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+static inline_function void wd_wheel_add(FAR struct wdog_s *wdog)
+{
+  clock_t expired = wdog->expired;
+  clock_t delta = expired - g_wdwheel.base;
+  int level;
+
+  if ((sclock_t)delta < 0)
+    {
+      expired = g_wdwheel.base;
+      delta   = 0;
+    }
+  else if (delta >= WDOG_WHEEL_RANGE)
+    {
+      expired = g_wdwheel.base + WDOG_WHEEL_RANGE - 1;
+      delta   = WDOG_WHEEL_RANGE - 1;
+    }
+
+  for (level = 0;
+       level < WDOG_WHEEL_LEVELS - 1 &&
+       delta >= ((clock_t)1 << (WDOG_WHEEL_BITS * (level + 1)));
+       level++);
+
+  list_add_tail(&g_wdwheel.slot[level]
+                [(expired >> (WDOG_WHEEL_BITS * level)) & WDOG_WHEEL_MASK],
+                &wdog->node);
+}
+
+/****************************************************************************
+ * Name: wd_wheel_cascade
+ *
+ * Description:
+ *   Re-hash all watchdogs of one slot of an upper level into the lower
+ *   levels of the wheel.
+ *
+ * Input Parameters:
+ *   slot - The slot to be emptied
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+static void wd_wheel_cascade(FAR struct list_node *slot)
+{
+  FAR struct wdog_s *wdog;
+  FAR struct wdog_s *tmp;
+
+  /* None of the watchdogs can land in this slot again:  They all expire
+   * before the slot comes around the next time.
+   */
+
+  list_for_every_entry_safe(slot, wdog, tmp, struct wdog_s, node)
+    {
+      list_delete(&wdog->node);
+      wd_wheel_add(wdog);
+    }
+}
+
+/****************************************************************************
+ * Name: wd_expiration
+ *
+ * Description:
+ *   Advance the timer wheel up to the current time, cascading upper level
+ *   slots as the lower levels wrap, and execute all watchdogs that have
+ *   expired.
+ *
+ * Input Parameters:
+ *   ticks - current time in ticks
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+static inline_function void wd_expiration(clock_t ticks)
+{
+  FAR struct list_node *slot;
+  FAR struct wdog_s    *wdog;
+  irqstate_t            flags;
+  wdentry_t             func;
+  wdparm_t              arg;
+  int                   index;
+  int                   level;
+
+  flags = spin_lock_irqsave(&g_wdspinlock);
+
+  while (clock_compare(g_wdwheel.base, ticks))
+    {
+      /* When the lower level wraps, pull the next slot of the level above
+       * down, continuing upwards while the upper levels wrap as well.
+       */
+
+      index = g_wdwheel.base & WDOG_WHEEL_MASK;
+      for (level = 1; index == 0 && level < WDOG_WHEEL_LEVELS; level++)
+        {
+          index = (g_wdwheel.base >> (WDOG_WHEEL_BITS * level)) &
+                  WDOG_WHEEL_MASK;
+          wd_wheel_cascade(&g_wdwheel.slot[level][index]);
+        }
+
+      /* Every watchdog in this level 0 slot expires at this tick */
+
+      slot = &g_wdwheel.slot[0][g_wdwheel.base & WDOG_WHEEL_MASK];
+      while (!list_is_empty(slot))
+        {
+          wdog = list_first_entry(slot, struct wdog_s, node);
+
+          /* Remove the watchdog from the wheel */
+
+          list_delete(&wdog->node);
+
+          /* Indicate that the watchdog is no longer active. */
+
+          func = wdog->func;
+          arg  = wdog->arg;
+          wdog->func = NULL;
+
+          /* Execute the watchdog function */
+
+          up_setpicbase(wdog->picbase);
+          spin_unlock_irqrestore(&g_wdspinlock, flags);
+
+          CALL_FUNC(func, arg);
+
+          flags = spin_lock_irqsave(&g_wdspinlock);
+        }
+
+      g_wdwheel.base++;
+    }
+
+  spin_unlock_irqrestore(&g_wdspinlock, flags);
+}
+
+/****************************************************************************
+ * Name: wd_insert
+ *
+ * Description:
+ *   Insert the timer into the timer wheel.
+ *
+ * Input Parameters:
+ *   wdog     - Watchdog ID
+ *   expired  - expired absolute time in clock ticks
+ *   wdentry  - Function to call on timeout
+ *   arg      - Parameter to pass to wdentry
+ *
+ * Assumptions:
+ *   wdog and wdentry is not NULL.
+ *
+ * Returned Value:
+ *   Always false:  The timer wheel is only used with the periodic timer
+ *   tick so there is no next expiration to reassess.
+ *
+ ****************************************************************************/
+
+static inline_function
+bool wd_insert(FAR struct wdog_s *wdog, clock_t expired,
+               wdentry_t wdentry, wdparm_t arg)
+{
+  wdog->func = wdentry;
+  up_getpicbase(&wdog->picbase);
+  wdog->arg = arg;
+  wdog->expired = expired;
+
+  wd_wheel_add(wdog);
+  return false;
+}
+
+#else
 /****************************************************************************
  * Name: wd_expiration
  *
@@ -118,6 +312,9 @@ static inline_function void wd_expiration(clock_t ticks)
   irqstate_t         flags;
   wdentry_t          func;
   wdparm_t           arg;
+#ifdef CONFIG_WDOG_TIMER_SLACK
+  unsigned int       nexpired = 0;
+#endif
 
   flags = spin_lock_irqsave(&g_wdspinlock);
 
@@ -144,6 +341,19 @@ static inline_function void wd_expiration(clock_t ticks)
           break;
         }
 
+#ifdef CONFIG_WDOG_TIMER_SLACK
+      /* Every expiration after the first one in this pass was served by
+       * the same timer interrupt.
+       */
+
+      if (nexpired++ > 0)
+        {
+          g_wdmerged++;
+        }
+
+      g_wdexpired++;
+#endif
+
       /* Remove the watchdog from the head of the list */
 
       list_delete(&wdog->node);
@@ -234,6 +444,8 @@ bool wd_insert(FAR struct wdog_s *wdog, clock_t expired,
   return head == curr;
 }
 
+#endif /* CONFIG_WDOG_TIMER_WHEEL */
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -274,8 +486,14 @@ bool wd_insert(FAR struct wdog_s *wdog, clock_t expired,
  *
  ****************************************************************************/
 
+#ifdef CONFIG_WDOG_TIMER_SLACK
+static int wd_start_internal(FAR struct wdog_s *wdog, clock_t ticks,
+                             clock_t slack, wdentry_t wdentry,
+                             wdparm_t arg)
+#else
 int wd_start_abstick(FAR struct wdog_s *wdog, clock_t ticks,
                      wdentry_t wdentry, wdparm_t arg)
+#endif
 {
   irqstate_t flags;
   bool reassess = false;
@@ -298,13 +516,22 @@ int wd_start_abstick(FAR struct wdog_s *wdog, clock_t ticks,
 
   if (WDOG_ISACTIVE(wdog))
     {
-      reassess |= list_is_head(&g_wdactivelist, &wdog->node);
+      reassess |= WDOG_ISHEAD(wdog);
       list_delete(&wdog->node);
       wdog->func = NULL;
     }
 
   reassess |= wd_insert(wdog, ticks, wdentry, arg);
 
+#ifdef CONFIG_WDOG_TIMER_SLACK
+  /* The interval timer must also be brought forward if it was deferred
+   * beyond the latest expiration time of the new watchdog.
+   */
+
+  wdog->slack = slack;
+  reassess |= !clock_compare(g_wdnexttime, ticks + slack);
+#endif
+
   if (!g_wdtimernested && reassess)
     {
       /* Resume the interval timer that will generate the next
@@ -338,6 +565,20 @@ int wd_start_abstick(FAR struct wdog_s *wdog, clock_t ticks,
   return OK;
 }
 
+#ifdef CONFIG_WDOG_TIMER_SLACK
+int wd_start_abstick(FAR struct wdog_s *wdog, clock_t ticks,
+                     wdentry_t wdentry, wdparm_t arg)
+{
+  FAR struct tcb_s *rtcb = this_task();
+
+  /* The timed waits of a thread use its timer slack */
+
+  return wd_start_internal(wdog, ticks,
+                           wdog == &rtcb->waitdog ? rtcb->timerslack : 0,
+                           wdentry, arg);
+}
+#endif
+
 /****************************************************************************
  * Name: wd_start
  *
@@ -387,6 +628,41 @@ int wd_start(FAR struct wdog_s *wdog, clock_t delay,
   return wd_start_abstick(wdog, clock_delay2abstick(delay), wdentry, arg);
 }
 
+/****************************************************************************
+ * Name: wd_start_slack
+ *
+ * Description:
+ *   Same as wd_start(), but the watchdog may expire up to 'slack' ticks
+ *   after the requested delay so that it can be coalesced with other
+ *   nearby watchdogs.
+ *
+ * Input Parameters:
+ *   wdog     - Watchdog ID
+ *   delay    - Delay count in clock ticks
+ *   slack    - Maximum additional delay in clock ticks
+ *   wdentry  - Function to call on timeout
+ *   arg      - Parameter to pass to wdentry
+ *
+ * Returned Value:
+ *   Zero (OK) is returned on success; a negated errno value is return to
+ *   indicate the nature of any failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_WDOG_TIMER_SLACK
+int wd_start_slack(FAR struct wdog_s *wdog, clock_t delay, clock_t slack,
+                   wdentry_t wdentry, wdparm_t arg)
+{
+  if (delay > WDOG_MAX_DELAY || slack > WDOG_MAX_DELAY - delay)
+    {
+      return -EINVAL;
+    }
+
+  return wd_start_internal(wdog, clock_delay2abstick(delay), slack,
+                           wdentry, arg);
+}
+#endif
+
 /****************************************************************************
  * Name: wd_timer
  *
@@ -442,7 +718,32 @@ clock_t wd_timer(clock_t ticks, bool noswitches)
    */
 
   wdog = list_first_entry(&g_wdactivelist, struct wdog_s, node);
+
+#ifdef CONFIG_WDOG_TIMER_SLACK
+  /* Defer the next expiration up to the latest time permitted by the
+   * slack of every watchdog that becomes due until then.  All of those
+   * are then handled by the same timer interrupt.
+   */
+
+  g_wdnexttime = wdog->expired + wdog->slack;
+
+  list_for_every_entry_continue(wdog, &g_wdactivelist, struct wdog_s, node)
+    {
+      if (!clock_compare(wdog->expired, g_wdnexttime))
+        {
+          break;
+        }
+
+      if (clock_compare(wdog->expired + wdog->slack, g_wdnexttime))
+        {
+          g_wdnexttime = wdog->expired + wdog->slack;
+        }
+    }
+
+  ret = g_wdnexttime - ticks;
+#else
   ret = wdog->expired - ticks;
+#endif
 
   spin_unlock_irqrestore(&g_wdspinlock, flags);
 
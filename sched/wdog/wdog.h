@@ -47,6 +47,38 @@
 
 #define list_node wdlist_node
 
+#ifdef CONFIG_WDOG_TIMER_WHEEL
+/* Geometry of the hierarchical timer wheel.  Level 0 has one slot per tick;
+ * each slot of level n covers WDOG_WHEEL_SIZE^n ticks.  Watchdogs further
+ * away than WDOG_WHEEL_RANGE are parked in the last level and re-queued
+ * whenever their slot cascades.
+ */
+
+#  define WDOG_WHEEL_LEVELS  4
+#  define WDOG_WHEEL_BITS    CONFIG_WDOG_TIMER_WHEEL_BITS
+#  define WDOG_WHEEL_SIZE    (1 << WDOG_WHEEL_BITS)
+#  define WDOG_WHEEL_MASK    (WDOG_WHEEL_SIZE - 1)
+#  define WDOG_WHEEL_RANGE   ((clock_t)1 << (WDOG_WHEEL_BITS * WDOG_WHEEL_LEVELS))
+
+/* Whether the watchdog determines the next timer expiration */
+
+#  define WDOG_ISHEAD(w)     false
+#else
+#  define WDOG_ISHEAD(w)     list_is_head(&g_wdactivelist, &(w)->node)
+#endif
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+#ifdef CONFIG_WDOG_TIMER_WHEEL
+struct wdog_wheel_s
+{
+  clock_t base;                     /* Next tick to be processed */
+  struct list_node slot[WDOG_WHEEL_LEVELS][WDOG_WHEEL_SIZE];
+};
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -64,13 +96,53 @@ extern "C"
  * this linked list are removed and the function is called.
  */
 
+#ifdef CONFIG_WDOG_TIMER_WHEEL
+/* With CONFIG_WDOG_TIMER_WHEEL, active watchdogs are instead hashed into
+ * the slots of g_wdwheel by expiration time so that they can be started
+ * and cancelled in constant time.
+ */
+
+extern struct wdog_wheel_s g_wdwheel;
+#else
 extern struct list_node g_wdactivelist;
+#endif
+
 extern spinlock_t g_wdspinlock;
 
+#ifdef CONFIG_WDOG_TIMER_SLACK
+/* Statistics of the expired watchdogs and of those that shared the timer
+ * interrupt with a preceding one, reported in /proc/wdog.
+ */
+
+extern unsigned long g_wdexpired;
+extern unsigned long g_wdmerged;
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: wd_initialize
+ *
+ * Description:
+ *   Initialize the watchdog timer wheel.  This must be called before any
+ *   watchdog is started.
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_WDOG_TIMER_WHEEL
+void wd_initialize(void);
+#else
+#  define wd_initialize()
+#endif
+
 /****************************************************************************
  * Name: wd_timer
  *
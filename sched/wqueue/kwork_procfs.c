@@ -0,0 +1,353 @@
+/****************************************************************************
+ * sched/wqueue/kwork_procfs.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/stat.h>
+#include <stdio.h>
+#include <fcntl.h>
+#include <string.h>
+#include <assert.h>
+#include <debug.h>
+#include <errno.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/clock.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/fs/fs.h>
+#include <nuttx/fs/procfs.h>
+
+#include "wqueue/wqueue.h"
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+#if defined(CONFIG_SCHED_WORKQUEUE_STATS) && \
+    !defined(CONFIG_FS_PROCFS_EXCLUDE_WQUEUE)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Output format:
+ *
+ *   QUEUE      COUNT      AVG(us)    MAX(us)
+ *   SSSSSSSSSS DDDDDDDDDD DDDDDDDDDD DDDDDDDDDD
+ */
+
+#define HDR_FMT "%-10s %-10s %-10s %s\n"
+#define WQ_FMT  "%-10s %-10lu %-10lu %lu\n"
+
+/* Determines the size of an intermediate buffer that must be large enough
+ * to handle the longest line generated by this logic.
+ */
+
+#define WQ_LINELEN 64
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This structure describes one open "file" */
+
+struct wqueue_file_s
+{
+  struct procfs_file_s base;  /* Base open file structure */
+  FAR char *buffer;           /* User provided buffer */
+  size_t remaining;           /* Number of available characters in buffer */
+  size_t ncopied;             /* Number of characters in buffer */
+  off_t offset;               /* Current file offset */
+  char line[WQ_LINELEN];      /* Pre-allocated buffer for formatted lines */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+/* File system methods */
+
+static int     wqueue_open(FAR struct file *filep, FAR const char *relpath,
+                 int oflags, mode_t mode);
+static int     wqueue_close(FAR struct file *filep);
+static ssize_t wqueue_read(FAR struct file *filep, FAR char *buffer,
+                 size_t buflen);
+static int     wqueue_dup(FAR const struct file *oldp,
+                 FAR struct file *newp);
+static int     wqueue_stat(FAR const char *relpath, FAR struct stat *buf);
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/* See fs_mount.c -- this structure is explicitly extern'ed there.
+ * We use the old-fashioned kind of initializers so that this will compile
+ * with any compiler.
+ */
+
+const struct procfs_operations g_wqueue_operations =
+{
+  wqueue_open,    /* open */
+  wqueue_close,   /* close */
+  wqueue_read,    /* read */
+  NULL,           /* write */
+  NULL,           /* poll */
+
+  wqueue_dup,     /* dup */
+
+  NULL,           /* opendir */
+  NULL,           /* closedir */
+  NULL,           /* readdir */
+  NULL,           /* rewinddir */
+
+  wqueue_stat     /* stat */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: wqueue_line
+ *
+ * Description:
+ *   Format one line of output and copy it to the user buffer.
+ *
+ ****************************************************************************/
+
+static void wqueue_line(FAR struct wqueue_file_s *attr, size_t linesize)
+{
+  size_t copysize;
+
+  copysize = procfs_memcpy(attr->line, linesize, attr->buffer,
+                           attr->remaining, &attr->offset);
+
+  attr->ncopied   += copysize;
+  attr->buffer    += copysize;
+  attr->remaining -= copysize;
+}
+
+/****************************************************************************
+ * Name: wqueue_report
+ *
+ * Description:
+ *   Output the statistics of one work queue.
+ *
+ ****************************************************************************/
+
+static void wqueue_report(FAR struct wqueue_file_s *attr,
+                          FAR const char *name,
+                          FAR struct kwork_wqueue_s *wqueue)
+{
+  unsigned long count;
+  unsigned long totallat;
+  clock_t maxlat;
+  irqstate_t flags;
+  size_t linesize;
+
+  /* Take a consistent snapshot of the counters */
+
+  flags    = spin_lock_irqsave(&wqueue->lock);
+  count    = wqueue->count;
+  totallat = wqueue->totallat;
+  maxlat   = wqueue->maxlat;
+  spin_unlock_irqrestore(&wqueue->lock, flags);
+
+  linesize = procfs_snprintf(attr->line, WQ_LINELEN, WQ_FMT, name, count,
+                             count ? (unsigned long)
+                                     TICK2USEC(totallat / count) : 0,
+                             (unsigned long)TICK2USEC(maxlat));
+  wqueue_line(attr, linesize);
+}
+
+/****************************************************************************
+ * Name: wqueue_open
+ ****************************************************************************/
+
+static int wqueue_open(FAR struct file *filep, FAR const char *relpath,
+                       int oflags, mode_t mode)
+{
+  FAR struct wqueue_file_s *attr;
+
+  finfo("Open '%s'\n", relpath);
+
+  /* This PROCFS file is read-only.  Any attempt to open with write access
+   * is not permitted.
+   */
+
+  if ((oflags & O_WRONLY) != 0 || (oflags & O_RDONLY) == 0)
+    {
+      ferr("ERROR: Only O_RDONLY supported\n");
+      return -EACCES;
+    }
+
+  /* Allocate a container to hold the file attributes */
+
+  attr = kmm_zalloc(sizeof(struct wqueue_file_s));
+  if (!attr)
+    {
+      ferr("ERROR: Failed to allocate file attributes\n");
+      return -ENOMEM;
+    }
+
+  /* Save the attributes as the open-specific state in filep->f_priv */
+
+  filep->f_priv = (FAR void *)attr;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: wqueue_close
+ ****************************************************************************/
+
+static int wqueue_close(FAR struct file *filep)
+{
+  FAR struct wqueue_file_s *attr;
+
+  /* Recover our private data from the struct file instance */
+
+  attr = (FAR struct wqueue_file_s *)filep->f_priv;
+  DEBUGASSERT(attr);
+
+  /* Release the file attributes structure */
+
+  kmm_free(attr);
+  filep->f_priv = NULL;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: wqueue_read
+ ****************************************************************************/
+
+static ssize_t wqueue_read(FAR struct file *filep, FAR char *buffer,
+                           size_t buflen)
+{
+  FAR struct wqueue_file_s *attr;
+  size_t linesize;
+#ifdef CONFIG_SCHED_HPWORK_PERCPU
+  char name[16];
+  int cpu;
+#endif
+
+  finfo("buffer=%p buflen=%d\n", buffer, (int)buflen);
+
+  /* Recover our private data from the struct file instance */
+
+  attr = (FAR struct wqueue_file_s *)filep->f_priv;
+  DEBUGASSERT(attr);
+
+  /* Save the file offset and the user buffer information */
+
+  attr->offset    = filep->f_pos;
+  attr->buffer    = buffer;
+  attr->remaining = buflen;
+  attr->ncopied   = 0;
+
+  /* The first line to output is the header */
+
+  linesize = procfs_snprintf(attr->line, WQ_LINELEN, HDR_FMT,
+                             "QUEUE", "COUNT", "AVG(us)", "MAX(us)");
+  wqueue_line(attr, linesize);
+
+  /* Then one line for each of the kernel work queues */
+
+#if defined(CONFIG_SCHED_HPWORK_PERCPU)
+  for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      snprintf(name, sizeof(name), HPWORKNAME "%d", cpu);
+      wqueue_report(attr, name,
+                    (FAR struct kwork_wqueue_s *)&g_hpwork[cpu]);
+    }
+#elif defined(CONFIG_SCHED_HPWORK)
+  wqueue_report(attr, HPWORKNAME, (FAR struct kwork_wqueue_s *)&g_hpwork);
+#endif
+
+#ifdef CONFIG_SCHED_LPWORK
+  wqueue_report(attr, LPWORKNAME, (FAR struct kwork_wqueue_s *)&g_lpwork);
+#endif
+
+  /* Update the file position */
+
+  filep->f_pos += attr->ncopied;
+  return attr->ncopied;
+}
+
+/****************************************************************************
+ * Name: wqueue_dup
+ *
+ * Description:
+ *   Duplicate open file data in the new file structure.
+ *
+ ****************************************************************************/
+
+static int wqueue_dup(FAR const struct file *oldp, FAR struct file *newp)
+{
+  FAR struct wqueue_file_s *oldattr;
+  FAR struct wqueue_file_s *newattr;
+
+  finfo("Dup %p->%p\n", oldp, newp);
+
+  /* Recover our private data from the old struct file instance */
+
+  oldattr = (FAR struct wqueue_file_s *)oldp->f_priv;
+  DEBUGASSERT(oldattr);
+
+  /* Allocate a new container to hold the file attributes */
+
+  newattr = kmm_malloc(sizeof(struct wqueue_file_s));
+  if (!newattr)
+    {
+      ferr("ERROR: Failed to allocate file attributes\n");
+      return -ENOMEM;
+    }
+
+  /* The copy the file attributes from the old attributes to the new */
+
+  memcpy(newattr, oldattr, sizeof(struct wqueue_file_s));
+
+  /* Save the new attributes in the new file structure */
+
+  newp->f_priv = (FAR void *)newattr;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: wqueue_stat
+ *
+ * Description: Return information about a file or directory
+ *
+ ****************************************************************************/
+
+static int wqueue_stat(FAR const char *relpath, FAR struct stat *buf)
+{
+  /* "wqueue" is the name for a read-only file */
+
+  memset(buf, 0, sizeof(struct stat));
+  buf->st_mode = S_IFREG | S_IROTH | S_IRGRP | S_IRUSR;
+  return OK;
+}
+
+#endif /* CONFIG_SCHED_WORKQUEUE_STATS &&
+        * !CONFIG_FS_PROCFS_EXCLUDE_WQUEUE */
+#endif /* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS */
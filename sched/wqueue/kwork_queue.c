@@ -87,6 +87,10 @@ int work_queue_next_wq(FAR struct kwork_wqueue_s *wqueue,
 
   flags = spin_lock_irqsave(&wqueue->lock);
 
+#ifdef CONFIG_SCHED_HPWORK_PERCPU
+  work->wq = wqueue;
+#endif
+
   if (delay)
     {
       /* Insert to the pending list of the wqueue. */
@@ -121,7 +125,8 @@ int work_queue_next_wq(FAR struct kwork_wqueue_s *wqueue,
 int work_queue_next(int qid, FAR struct work_s *work, worker_t worker,
                     FAR void *arg, clock_t delay)
 {
-  return work_queue_next_wq(work_qid2wq(qid), work, worker, arg, delay);
+  return work_queue_next_wq(work_qid2wq_work(qid, work, false), work,
+                            worker, arg, delay);
 }
 
 /****************************************************************************
@@ -174,7 +179,7 @@ int work_queue_wq(FAR struct kwork_wqueue_s *wqueue,
    * task logic or from interrupt handling logic.
    */
 
-  flags = spin_lock_irqsave(&wqueue->lock);
+  flags = work_lock_wq(&wqueue, work);
 
   /* Ensure the work has been removed. */
 
@@ -185,6 +190,9 @@ int work_queue_wq(FAR struct kwork_wqueue_s *wqueue,
   work->worker = worker;   /* Work callback. non-NULL means queued */
   work->arg    = arg;      /* Callback argument */
   work->qtime  = expected; /* Expected time */
+#ifdef CONFIG_SCHED_HPWORK_PERCPU
+  work->wq     = wqueue;   /* Owning work queue */
+#endif
 
   if (delay)
     {
@@ -226,7 +234,8 @@ int work_queue_wq(FAR struct kwork_wqueue_s *wqueue,
 int work_queue(int qid, FAR struct work_s *work, worker_t worker,
                FAR void *arg, clock_t delay)
 {
-  return work_queue_wq(work_qid2wq(qid), work, worker, arg, delay);
+  return work_queue_wq(work_qid2wq_work(qid, work, false), work, worker,
+                       arg, delay);
 }
 
 #endif /* CONFIG_SCHED_WORKQUEUE */
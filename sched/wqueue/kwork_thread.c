@@ -78,7 +78,14 @@
  * Public Data
  ****************************************************************************/
 
-#if defined(CONFIG_SCHED_HPWORK)
+#if defined(CONFIG_SCHED_HPWORK_PERCPU)
+/* The state of the kernel mode, high priority work queue of each CPU.
+ * These are set up by work_initialize_highpri().
+ */
+
+struct hp_wqueue_s g_hpwork[CONFIG_SMP_NCPUS];
+
+#elif defined(CONFIG_SCHED_HPWORK)
 /* The state of the kernel mode, high priority work queue(s). */
 
 struct hp_wqueue_s g_hpwork =
@@ -161,6 +168,40 @@ void work_dispatch(FAR struct kwork_wqueue_s *wq)
     }
 }
 
+/****************************************************************************
+ * Name: work_update_stats
+ *
+ * Description:
+ *   Record the queueing latency of a work that is about to be started.
+ *
+ * Assumptions:
+ *   The caller holds the work queue lock.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_WORKQUEUE_STATS
+static inline_function
+void work_update_stats(FAR struct kwork_wqueue_s *wq,
+                       FAR struct work_s *work)
+{
+  sclock_t latency = clock_systime_ticks() - work->qtime;
+
+  /* Work queued without delay is due one tick after it was queued */
+
+  if (latency < 0)
+    {
+      latency = 0;
+    }
+
+  wq->count++;
+  wq->totallat += latency;
+  if (latency > wq->maxlat)
+    {
+      wq->maxlat = latency;
+    }
+}
+#endif
+
 /****************************************************************************
  * Name: work_thread
  *
@@ -199,6 +240,20 @@ static int work_thread(int argc, FAR char *argv[])
   kworker = (FAR struct kworker_s *)
             ((uintptr_t)strtoul(argv[2], NULL, 16));
 
+#ifdef CONFIG_SCHED_HPWORK_PERCPU
+  /* The workers of a per-CPU queue may only run on the CPU of that queue */
+
+  if ((FAR struct hp_wqueue_s *)wqueue >= g_hpwork &&
+      (FAR struct hp_wqueue_s *)wqueue < &g_hpwork[CONFIG_SMP_NCPUS])
+    {
+      cpu_set_t cpuset;
+
+      CPU_ZERO(&cpuset);
+      CPU_SET((FAR struct hp_wqueue_s *)wqueue - g_hpwork, &cpuset);
+      nxsched_set_affinity(0, sizeof(cpuset), &cpuset);
+    }
+#endif
+
   /* Loop until wqueue->exit != 0.
    * Since the only way to set wqueue->exit is to call work_queue_free(),
    * there is no need for entering the critical section.
@@ -239,6 +294,12 @@ static int work_thread(int argc, FAR char *argv[])
 
           arg = work->arg;
 
+#ifdef CONFIG_SCHED_WORKQUEUE_STATS
+          /* Account for the time the work waited since it became due */
+
+          work_update_stats(wqueue, work);
+#endif
+
           /* Return the work structure ownership to the work owner. */
 
           work->worker = NULL;
@@ -550,6 +611,29 @@ int work_queue_priority(int qid)
 #ifdef CONFIG_SCHED_HPWORK
 int work_start_highpri(void)
 {
+#ifdef CONFIG_SCHED_HPWORK_PERCPU
+  char name[CONFIG_TASK_NAME_SIZE + 1];
+  int ret;
+  int cpu;
+
+  /* Start the high-priority, kernel mode worker thread(s) of each CPU */
+
+  sinfo("Starting per-CPU high-priority kernel worker thread(s)\n");
+
+  for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      snprintf(name, sizeof(name), HPWORKNAME "%d", cpu);
+      ret = work_thread_create(name, CONFIG_SCHED_HPWORKPRIORITY, NULL,
+                               CONFIG_SCHED_HPWORKSTACKSIZE,
+                               (FAR struct kwork_wqueue_s *)&g_hpwork[cpu]);
+      if (ret < 0)
+        {
+          return ret;
+        }
+    }
+
+  return OK;
+#else
   /* Start the high-priority, kernel mode worker thread(s) */
 
   sinfo("Starting high-priority kernel worker thread(s)\n");
@@ -557,9 +641,45 @@ int work_start_highpri(void)
   return work_thread_create(HPWORKNAME, CONFIG_SCHED_HPWORKPRIORITY, NULL,
                             CONFIG_SCHED_HPWORKSTACKSIZE,
                             (FAR struct kwork_wqueue_s *)&g_hpwork);
+#endif
 }
 #endif /* CONFIG_SCHED_HPWORK */
 
+/****************************************************************************
+ * Name: work_initialize_highpri
+ *
+ * Description:
+ *   Initialize the per-CPU high-priority work queues so that work can be
+ *   queued before the worker threads are started.
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_HPWORK_PERCPU
+void work_initialize_highpri(void)
+{
+  FAR struct kwork_wqueue_s *wqueue;
+  int cpu;
+
+  for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      wqueue = (FAR struct kwork_wqueue_s *)&g_hpwork[cpu];
+
+      list_initialize(&wqueue->expired);
+      list_initialize(&wqueue->pending);
+      nxsem_init(&wqueue->sem, 0, 0);
+      nxsem_init(&wqueue->exsem, 0, 0);
+      spin_lock_init(&wqueue->lock);
+      wqueue->nthreads = CONFIG_SCHED_HPNTHREADS;
+    }
+}
+#endif /* CONFIG_SCHED_HPWORK_PERCPU */
+
 /****************************************************************************
  * Name: work_start_lowpri
  *
@@ -34,6 +34,7 @@
 
 #include <nuttx/clock.h>
 #include <nuttx/list.h>
+#include <nuttx/sched.h>
 #include <nuttx/wqueue.h>
 #include <nuttx/spinlock.h>
 
@@ -81,6 +82,11 @@ struct kwork_wqueue_s
   uint8_t          nthreads;  /* Number of worker threads */
   bool             exit;      /* A flag to request the thread to exit */
   struct wdog_s    timer;     /* Timer to pending. */
+#ifdef CONFIG_SCHED_WORKQUEUE_STATS
+  unsigned long    count;     /* Number of work items started */
+  unsigned long    totallat;  /* Sum of the queueing latencies in ticks */
+  clock_t          maxlat;    /* Largest queueing latency in ticks */
+#endif
 };
 
 /* This structure defines the state of one high-priority work queue.  This
@@ -117,7 +123,11 @@ struct lp_wqueue_s
  * Public Data
  ****************************************************************************/
 
-#ifdef CONFIG_SCHED_HPWORK
+#ifdef CONFIG_SCHED_HPWORK_PERCPU
+/* The state of the kernel mode, high priority work queue of each CPU. */
+
+extern struct hp_wqueue_s g_hpwork[CONFIG_SMP_NCPUS];
+#elif defined(CONFIG_SCHED_HPWORK)
 /* The state of the kernel mode, high priority work queue. */
 
 extern struct hp_wqueue_s g_hpwork;
@@ -138,7 +148,11 @@ static inline_function FAR struct kwork_wqueue_s *work_qid2wq(int qid)
 #ifdef CONFIG_SCHED_HPWORK
   if (qid == HPWORK)
     {
+#  ifdef CONFIG_SCHED_HPWORK_PERCPU
+      return (FAR struct kwork_wqueue_s *)&g_hpwork[this_cpu()];
+#  else
       return (FAR struct kwork_wqueue_s *)&g_hpwork;
+#  endif
     }
   else
 #endif
@@ -154,6 +168,61 @@ static inline_function FAR struct kwork_wqueue_s *work_qid2wq(int qid)
     }
 }
 
+/* Return the work queue that a work must be queued to or cancelled from.
+ * With per-CPU high priority queues, a work that is still queued (or that
+ * is being cancelled) is handled by the queue that it was queued to;
+ * otherwise the queue of the calling CPU is used.
+ */
+
+#ifdef CONFIG_SCHED_HPWORK_PERCPU
+static inline_function FAR struct kwork_wqueue_s *
+work_qid2wq_work(int qid, FAR struct work_s *work, bool cancel)
+{
+  if (qid == HPWORK && work != NULL && work->wq != NULL &&
+      (cancel || !work_available(work)))
+    {
+      return work->wq;
+    }
+
+  return work_qid2wq(qid);
+}
+#else
+#  define work_qid2wq_work(qid, work, cancel) work_qid2wq(qid)
+#endif
+
+/* Lock the queue that a pending work is linked on.  The work_qid2wq_work()
+ * lookup reads work->wq without a lock, and the work may have run and been
+ * queued to another CPU since.  work->wq of a pending work only changes
+ * with its queue locked, so it is checked again under the lock and the
+ * lookup repeated if the work moved.  An idle work is not linked anywhere
+ * and is left to the queue that was passed in; queueing the same idle work
+ * from two CPUs at once is therefore not supported.
+ */
+
+#ifdef CONFIG_SCHED_HPWORK_PERCPU
+static inline_function irqstate_t
+work_lock_wq(FAR struct kwork_wqueue_s **wqueue, FAR struct work_s *work)
+{
+  FAR struct kwork_wqueue_s *owner;
+  irqstate_t flags;
+
+  for (; ; )
+    {
+      flags = spin_lock_irqsave(&(*wqueue)->lock);
+      owner = work->wq;
+      if (work_available(work) || owner == NULL || owner == *wqueue)
+        {
+          return flags;
+        }
+
+      spin_unlock_irqrestore(&(*wqueue)->lock, flags);
+      *wqueue = owner;
+    }
+}
+#else
+#  define work_lock_wq(wqueue, work) spin_lock_irqsave(&(*(wqueue))->lock)
+#endif
+
 /****************************************************************************
  * Name: work_insert_pending
  *
@@ -307,6 +376,19 @@ void work_timer_reset(FAR struct kwork_wqueue_s *wqueue)
 int work_start_highpri(void);
 #endif
 
+/****************************************************************************
+ * Name: work_initialize_highpri
+ *
+ * Description:
+ *   Initialize the per-CPU high-priority work queues so that work can be
+ *   queued before the worker threads are started.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_HPWORK_PERCPU
+void work_initialize_highpri(void);
+#endif
+
 /****************************************************************************
  * Name: work_start_lowpri
  *
@@ -45,6 +45,28 @@ def test_mm(p):
     assert ret == 0
 
 
+def heapprof_inuse(p):
+    if p.sendCommand("cat /proc/heapprof", r"heap profile: (\d+): (\d+) ") != 0:
+        return None
+    return p.process.match.groups()
+
+
+def test_heapprof(p):
+    if p.sendCommand("ls /proc", "heapprof") != 0:
+        pytest.skip("no /proc/heapprof at {}".format(p.board))
+
+    # The heap test frees everything it allocates, including memalign()
+    # blocks, so the sampled in-use counts must come back to where they
+    # were.  A first run settles what the task start-up leaves behind.
+
+    p.sendCommand("heap", "TEST COMPLETE", timeout=120)
+    before = heapprof_inuse(p)
+    ret = p.sendCommand("heap", "TEST COMPLETE", timeout=120)
+    after = heapprof_inuse(p)
+    assert ret == 0
+    assert before is not None and before == after
+
+
 def test_cxxtest(p):
     if p.board in do_not_support:
         pytest.skip("unsupported at {}".format(p.board))